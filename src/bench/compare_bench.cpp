@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares inplace_vector's operator== and operator<=> against the generic element-wise algorithms over its
+// iterators, for byte and int elements, over a range of sizes. The vectors compared are equal up to the last element,
+// so that each comparison inspects every element.
+
+#include "inplace_vector.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+template <typename T, std::size_t N>
+struct Operands
+{
+    jell::inplace_vector<T, N> lhs;
+    jell::inplace_vector<T, N> rhs;
+
+    explicit Operands(std::size_t size)
+    {
+        for (std::size_t i = 0; i != size; ++i) {
+            lhs.push_back(static_cast<T>(i * 7));
+            rhs.push_back(static_cast<T>(i * 7 + (i + 1 == size ? 1 : 0)));
+        }
+    }
+};
+
+template <typename T, std::size_t N>
+void BM_equal_generic(benchmark::State& state)
+{
+    const auto operands = std::make_unique<Operands<T, N>>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        const auto& [lhs, rhs] = *operands;
+        benchmark::DoNotOptimize(std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * N * sizeof(T)));
+}
+
+template <typename T, std::size_t N>
+void BM_equal(benchmark::State& state)
+{
+    const auto operands = std::make_unique<Operands<T, N>>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(operands->lhs == operands->rhs);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * N * sizeof(T)));
+}
+
+template <typename T, std::size_t N>
+void BM_compare_three_way_generic(benchmark::State& state)
+{
+    const auto operands = std::make_unique<Operands<T, N>>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        const auto& [lhs, rhs] = *operands;
+        benchmark::DoNotOptimize(
+            std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * N * sizeof(T)));
+}
+
+template <typename T, std::size_t N>
+void BM_compare_three_way(benchmark::State& state)
+{
+    const auto operands = std::make_unique<Operands<T, N>>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(operands->lhs <=> operands->rhs);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * N * sizeof(T)));
+}
+
+#define BENCHMARK_COMPARE(T, N)                                                                         \
+    BENCHMARK(BM_equal_generic<T, N>)->Name("equal/generic/" #T "/" #N);                                \
+    BENCHMARK(BM_equal<T, N>)->Name("equal/inplace_vector/" #T "/" #N);                                 \
+    BENCHMARK(BM_compare_three_way_generic<T, N>)->Name("compare_three_way/generic/" #T "/" #N);        \
+    BENCHMARK(BM_compare_three_way<T, N>)->Name("compare_three_way/inplace_vector/" #T "/" #N)
+
+BENCHMARK_COMPARE(std::uint8_t, 16);
+BENCHMARK_COMPARE(std::uint8_t, 64);
+BENCHMARK_COMPARE(std::uint8_t, 1024);
+BENCHMARK_COMPARE(int, 16);
+BENCHMARK_COMPARE(int, 64);
+BENCHMARK_COMPARE(int, 1024);
+
+} // namespace
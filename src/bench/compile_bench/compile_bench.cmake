@@ -0,0 +1,125 @@
+# Measure the compile time and code size of inplace_vector: of SOURCE compiled without an instantiation (the cost of
+# the includes), and with each instantiation in the matrix TYPES x CAPACITIES. The results are written to OUTPUT as
+# JSON. With Clang, the times are the -ftime-trace totals, and the cost of the <format> and <algorithm> includes is
+# reported separately; otherwise, only the wall-clock time of each compilation is reported. The code size is the sum
+# of the .text sections of the object file, as reported by SIZE_TOOL.
+#
+# cmake -DCOMPILER=<compiler> -DCOMPILER_ID=<id> -DFLAGS=<flags> -DOPTIMIZATION=<-On> -DINCLUDE_DIR=<dir>
+#       -DSOURCE=<source> -DTYPES=<type|...> -DCAPACITIES=<n|...> -DSIZE_TOOL=<size> -DOUTPUT_DIR=<dir>
+#       -DOUTPUT=<json> -P compile_bench.cmake
+
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+string(REPLACE "|" ";" types "${TYPES}")
+string(REPLACE "|" ";" capacities "${CAPACITIES}")
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+set(time_trace OFF)
+if(COMPILER_ID MATCHES "Clang")
+    set(time_trace ON)
+endif()
+
+# The clang -ftime-trace totals to report, and their names in the JSON.
+set(trace_totals ExecuteCompiler Frontend Backend InstantiateClass InstantiateFunction)
+set(trace_names compile_time_us frontend_us backend_us instantiate_class_us instantiate_function_us)
+
+# Compile SOURCE with the given definitions to <name>.o, and set <name>_json to a JSON object of its measurements.
+function(measure name)
+    set(object ${OUTPUT_DIR}/${name}.o)
+    set(trace_flags)
+    if(time_trace)
+        # The granularity is lowered so that short includes still appear in the trace.
+        set(trace_flags -ftime-trace -ftime-trace-granularity=50)
+    endif()
+
+    string(TIMESTAMP start "%s%f" UTC)
+    execute_process(
+        COMMAND ${COMPILER} ${flags} -std=c++23 ${OPTIMIZATION} ${trace_flags} ${ARGN}
+                -I${INCLUDE_DIR} -c -o ${object} ${SOURCE}
+        ERROR_VARIABLE errors
+        RESULT_VARIABLE result
+    )
+    string(TIMESTAMP end "%s%f" UTC)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to compile ${name}:\n${errors}")
+    endif()
+
+    set(json "{}")
+    string(JSON json SET "${json}" name "\"${name}\"")
+
+    if(time_trace)
+        file(READ ${OUTPUT_DIR}/${name}.json trace)
+        foreach(total json_name IN ZIP_LISTS trace_totals trace_names)
+            set(duration 0)
+            if(trace MATCHES "\"dur\":([0-9]+),\"name\":\"Total ${total}\"")
+                set(duration ${CMAKE_MATCH_1})
+            endif()
+            string(JSON json SET "${json}" ${json_name} ${duration})
+        endforeach()
+
+        # The first inclusion of each header is the one that parses it.
+        foreach(header format algorithm)
+            set(duration 0)
+            if(trace MATCHES "\"dur\":([0-9]+),\"name\":\"Source\",\"args\":{\"detail\":\"[^\"]*/${header}\"}")
+                set(duration ${CMAKE_MATCH_1})
+            endif()
+            string(JSON json SET "${json}" include_${header}_us ${duration})
+        endforeach()
+    else()
+        math(EXPR duration "${end} - ${start}")
+        string(JSON json SET "${json}" compile_time_us ${duration})
+    endif()
+
+    execute_process(
+        COMMAND ${SIZE_TOOL} -A ${object}
+        OUTPUT_VARIABLE sections
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Failed to read the sections of ${object}")
+    endif()
+    # Each instantiated function has a .text.<name> section of its own.
+    set(text_bytes 0)
+    string(REGEX MATCHALL "(^|\n)\\.text[^ \n]* +[0-9]+" text_sections "${sections}")
+    foreach(section IN LISTS text_sections)
+        string(REGEX MATCH "[0-9]+$" bytes "${section}")
+        math(EXPR text_bytes "${text_bytes} + ${bytes}")
+    endforeach()
+    string(JSON json SET "${json}" text_bytes ${text_bytes})
+
+    set(${name}_json "${json}" PARENT_SCOPE)
+endfunction()
+
+set(report "{}")
+string(JSON report SET "${report}" compiler "\"${COMPILER_ID}\"")
+string(JSON report SET "${report}" flags "\"${FLAGS} ${OPTIMIZATION}\"")
+
+measure(baseline)
+string(JSON report SET "${report}" baseline "${baseline_json}")
+string(JSON baseline_time GET "${baseline_json}" compile_time_us)
+string(JSON baseline_text GET "${baseline_json}" text_bytes)
+
+# Each instantiation is also reported less the baseline: its own cost.
+set(instantiations "[]")
+set(index 0)
+foreach(type IN LISTS types)
+    foreach(capacity IN LISTS capacities)
+        string(MAKE_C_IDENTIFIER "${type}_${capacity}" name)
+        measure(${name} -DJELL_BENCH_T=${type} -DJELL_BENCH_N=${capacity})
+        set(json "${${name}_json}")
+        string(JSON json SET "${json}" type "\"${type}\"")
+        string(JSON json SET "${json}" capacity ${capacity})
+        string(JSON time GET "${json}" compile_time_us)
+        string(JSON text GET "${json}" text_bytes)
+        math(EXPR time "${time} - ${baseline_time}")
+        math(EXPR text "${text} - ${baseline_text}")
+        string(JSON json SET "${json}" instantiation_time_us ${time})
+        string(JSON json SET "${json}" instantiation_text_bytes ${text})
+        string(JSON instantiations SET "${instantiations}" ${index} "${json}")
+        math(EXPR index "${index} + 1")
+        message(STATUS "inplace_vector<${type}, ${capacity}>: ${time} us, ${text} bytes of .text")
+    endforeach()
+endforeach()
+string(JSON report SET "${report}" instantiations "${instantiations}")
+
+file(WRITE ${OUTPUT} "${report}\n")
+message(STATUS "Wrote ${OUTPUT}")
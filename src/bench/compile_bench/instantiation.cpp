@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// A translation unit for compile_bench.cmake. Compiled with JELL_BENCH_T and JELL_BENCH_N defined, it instantiates
+// inplace_vector<JELL_BENCH_T, JELL_BENCH_N>: explicit instantiation defines every non-template member, and the member
+// templates are odr-used below with representative arguments. Without them, it measures the cost of the includes alone.
+
+#include "inplace_vector.hpp"
+
+#include <list>
+#include <string>
+
+#if defined(JELL_BENCH_T)
+template class jell::inplace_vector<JELL_BENCH_T, JELL_BENCH_N>;
+
+namespace {
+
+using element_type = JELL_BENCH_T;
+using vector_type  = jell::inplace_vector<element_type, JELL_BENCH_N>;
+using other_type   = jell::inplace_vector<element_type, JELL_BENCH_N + 1>;
+
+} // namespace
+
+/// Call each member template once: with a contiguous range (pointers) and a non-contiguous one (std::list iterators),
+/// a single element to construct from, a predicate, and a vector of another capacity.
+void use_member_templates(vector_type& v, other_type& other, const std::list<element_type>& list,
+                          const element_type& value)
+{
+    const element_type* const first = &value;
+    const element_type* const last  = &value + 1;
+
+    vector_type from_pointers(first, last);
+    vector_type from_list(list.begin(), list.end());
+    vector_type from_range(std::from_range, list);
+    (void)vector_type::try_from_range(list);
+    vector_type from_other(other);
+    vector_type from_moved_other(std::move(other));
+
+    v = other;
+    v = std::move(other);
+    v.assign(first, last);
+    v.assign(list.begin(), list.end());
+    (void)v.try_assign(first, last);
+    (void)v.try_assign(list.begin(), list.end());
+    (void)v.try_assign(other);
+    (void)v.try_assign(std::move(other));
+    v.assign_range(list);
+    (void)v.try_assign_range(list);
+
+    v.insert(v.begin(), first, last);
+    v.insert(v.begin(), list.begin(), list.end());
+    v.insert_range(v.begin(), list);
+    (void)v.try_insert(v.begin(), first, last);
+    (void)v.try_insert(v.begin(), list.begin(), list.end());
+    (void)v.try_insert_range(v.begin(), list);
+    v.emplace(v.begin(), value);
+    (void)v.try_emplace(v.begin(), value);
+    v.emplace_back(value);
+    (void)v.try_emplace_back(value);
+    v.unchecked_emplace_back(value);
+    v.append_range(list);
+    (void)v.try_append_range(list);
+
+    // resize_and_overwrite is constrained on trivial elements; the generic lambda defers the check to its call.
+    [](auto& vec) {
+        if constexpr (requires { vec.resize_and_overwrite(0, [](auto*, std::size_t n) { return n; }); }) {
+            vec.resize_and_overwrite(vec.size(), [](auto*, std::size_t n) { return n; });
+        }
+    }(v);
+    (void)v.unordered_erase_if([&](const element_type& e) { return e == value; });
+    (void)v.erase_indices(std::initializer_list<std::size_t>{0});
+
+    (void)(v == other);
+    (void)(v <=> other);
+}
+#endif
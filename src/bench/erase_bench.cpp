@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares std::erase_if on an inplace_vector of 4-byte arithmetic elements, which compacts with the widest SIMD
+// kernel the CPU supports, against the generic std::remove_if and erase, over a range of sizes, with half of the
+// elements erased.
+
+#include "inplace_vector.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+namespace {
+
+template <typename T, std::size_t N, bool Generic>
+void BM_erase_if(benchmark::State& state)
+{
+    using vector = jell::inplace_vector<T, N>;
+
+    auto source = std::make_unique<vector>();
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int> values{0, 99};
+    for (std::size_t i = 0; i != N; ++i) {
+        source->push_back(static_cast<T>(values(random)));
+    }
+    const auto predicate = [](T value) { return value < T{50}; };
+
+    auto v = std::make_unique<vector>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        state.PauseTiming();
+        counters.pause();
+        *v = *source;
+        counters.resume();
+        state.ResumeTiming();
+        if constexpr (Generic) {
+            v->erase(std::remove_if(v->begin(), v->end(), predicate), v->end());
+        } else {
+            std::erase_if(*v, predicate);
+        }
+        benchmark::DoNotOptimize(v->data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+#define BENCHMARK_ERASE_IF(T, N)                                                            \
+    BENCHMARK(BM_erase_if<T, N, true>)->Name("erase_if/generic/" #T "/" #N);                \
+    BENCHMARK(BM_erase_if<T, N, false>)->Name("erase_if/inplace_vector/" #T "/" #N)
+
+BENCHMARK_ERASE_IF(std::uint32_t, 64);
+BENCHMARK_ERASE_IF(std::uint32_t, 1024);
+BENCHMARK_ERASE_IF(std::uint32_t, 16384);
+BENCHMARK_ERASE_IF(float, 64);
+BENCHMARK_ERASE_IF(float, 1024);
+BENCHMARK_ERASE_IF(float, 16384);
+
+} // namespace
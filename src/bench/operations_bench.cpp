@@ -0,0 +1,434 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Measures every public mutating and comparing operation of inplace_vector against the containers it is meant to
+// replace: a std::vector that has reserved its capacity up front, a std::array paired with an element count, and the
+// standard library's std::inplace_vector where it is available. Each operation is swept over int, a non-trivial
+// element type, std::string and a 64-byte trivially copyable type, and over capacities from 4 to 65536. Benchmarks are
+// named "<operation>/<container>/<element>/<capacity>", so that the JSON output of two runs can be diffed by name.
+
+#include "inplace_vector.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<inplace_vector>)
+#include <inplace_vector>
+#endif
+
+namespace {
+
+/// An element with user-provided special members, so that no operation can be lowered to a memcpy.
+class NonTrivial
+{
+public:
+    NonTrivial() noexcept = default;
+    explicit NonTrivial(std::size_t value) noexcept : value_(value) {}
+    NonTrivial(const NonTrivial& other) noexcept : value_(other.value_) {}
+    NonTrivial(NonTrivial&& other) noexcept : value_(std::exchange(other.value_, 0)) {}
+    ~NonTrivial() { benchmark::DoNotOptimize(value_); }
+
+    NonTrivial& operator=(const NonTrivial& other) noexcept
+    {
+        value_ = other.value_;
+        return *this;
+    }
+
+    NonTrivial& operator=(NonTrivial&& other) noexcept
+    {
+        value_ = std::exchange(other.value_, 0);
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t value() const noexcept { return value_; }
+
+    friend bool operator==(const NonTrivial&, const NonTrivial&) = default;
+    friend auto operator<=>(const NonTrivial&, const NonTrivial&) = default;
+
+private:
+    std::size_t value_ = 0;
+};
+
+/// A trivially copyable element the size of a cache line.
+struct Pod64
+{
+    std::uint64_t values[8];
+
+    friend bool operator==(const Pod64&, const Pod64&) = default;
+    friend auto operator<=>(const Pod64&, const Pod64&) = default;
+};
+
+static_assert(sizeof(Pod64) == 64);
+
+template <typename T>
+T make_value(std::size_t i);
+
+template <>
+int make_value<int>(std::size_t i)
+{
+    return static_cast<int>(i);
+}
+
+template <>
+NonTrivial make_value<NonTrivial>(std::size_t i)
+{
+    return NonTrivial(i);
+}
+
+template <>
+std::string make_value<std::string>(std::size_t i)
+{
+    // Long enough to defeat the small string optimisation of every standard library.
+    return std::string(32, static_cast<char>('a' + i % 26));
+}
+
+template <>
+Pod64 make_value<Pod64>(std::size_t i)
+{
+    return Pod64{{i, i, i, i, i, i, i, i}};
+}
+
+/// The index a value was made from, modulo 26, used to select the elements erased by erase_if.
+std::size_t key(int value) { return static_cast<std::size_t>(value); }
+std::size_t key(const NonTrivial& value) { return value.value(); }
+std::size_t key(const std::string& value) { return static_cast<std::size_t>(value.front() - 'a'); }
+std::size_t key(const Pod64& value) { return value.values[0]; }
+
+/// A std::vector that reserves its capacity on construction, so that no benchmarked operation reallocates.
+template <typename T, std::size_t N>
+struct reserved_vector : std::vector<T>
+{
+    reserved_vector() { this->reserve(N); }
+};
+
+/// A std::array paired with an element count: the hand-rolled alternative to an inplace_vector. All N elements are
+/// always alive, so inserting assigns over an existing element rather than constructing one.
+template <typename T, std::size_t N>
+class array_vector
+{
+public:
+    using value_type     = T;
+    using iterator       = T*;
+    using const_iterator = const T*;
+
+    [[nodiscard]] T* data() noexcept { return elements_.data(); }
+    [[nodiscard]] const T* data() const noexcept { return elements_.data(); }
+    [[nodiscard]] T* begin() noexcept { return data(); }
+    [[nodiscard]] const T* begin() const noexcept { return data(); }
+    [[nodiscard]] T* end() noexcept { return data() + size_; }
+    [[nodiscard]] const T* end() const noexcept { return data() + size_; }
+    [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+    void push_back(const T& value) { elements_[size_++] = value; }
+
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        return elements_[size_++] = T(std::forward<Args>(args)...);
+    }
+
+    T* insert(const T* position, const T& value)
+    {
+        auto* target = begin() + (position - begin());
+        std::move_backward(target, end(), end() + 1);
+        *target = value;
+        ++size_;
+        return target;
+    }
+
+    T* erase(const T* position)
+    {
+        auto* target = begin() + (position - begin());
+        std::move(target + 1, end(), target);
+        --size_;
+        return target;
+    }
+
+    template <typename InputIterator>
+    void assign(InputIterator first, InputIterator last)
+    {
+        size_ = static_cast<std::size_t>(std::copy(first, last, begin()) - begin());
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    void swap(array_vector& other)
+    {
+        std::swap_ranges(begin(), begin() + std::max(size_, other.size_), other.begin());
+        std::swap(size_, other.size_);
+    }
+
+    friend bool operator==(const array_vector& lhs, const array_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend auto operator<=>(const array_vector& lhs, const array_vector& rhs)
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename Predicate>
+    friend std::size_t erase_if(array_vector& vector, Predicate predicate)
+    {
+        const auto removed = static_cast<std::size_t>(
+            vector.end() - std::remove_if(vector.begin(), vector.end(), predicate));
+        vector.size_ -= removed;
+        return removed;
+    }
+
+private:
+    std::array<T, N> elements_{};
+    std::size_t size_ = 0;
+};
+
+template <typename Container>
+std::unique_ptr<Container> make_filled(std::size_t size)
+{
+    auto container = std::make_unique<Container>();
+    for (std::size_t i = 0; i != size; ++i) {
+        container->push_back(make_value<typename Container::value_type>(i));
+    }
+    return container;
+}
+
+template <typename Container, std::size_t N>
+void BM_push_back(benchmark::State& state)
+{
+    const auto value = make_value<typename Container::value_type>(1);
+    auto vector = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i != N; ++i) {
+            vector->push_back(value);
+        }
+        benchmark::DoNotOptimize(vector->data());
+        vector->clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_emplace_back(benchmark::State& state)
+{
+    auto vector = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i != N; ++i) {
+            vector->emplace_back();
+        }
+        benchmark::DoNotOptimize(vector->data());
+        vector->clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+enum class position { front, middle, back };
+
+template <typename Container, std::size_t N>
+void BM_insert_erase(benchmark::State& state, position where)
+{
+    // Insert into a half-full vector and erase the inserted element again, so that the size is the same at the start
+    // of every iteration and both operations shift the same number of elements.
+    const auto value = make_value<typename Container::value_type>(1);
+    auto vector = make_filled<Container>(N / 2);
+    const auto offset = where == position::front ? 0 : where == position::middle ? N / 4 : N / 2;
+    jell::bench::perf_counters counters{state};
+    for (auto _ : state) {
+        auto inserted = vector->insert(vector->begin() + offset, value);
+        vector->erase(inserted);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+template <typename Container, std::size_t N>
+void BM_assign(benchmark::State& state)
+{
+    std::vector<typename Container::value_type> source;
+    for (std::size_t i = 0; i != N; ++i) {
+        source.push_back(make_value<typename Container::value_type>(i));
+    }
+    auto vector = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        vector->assign(source.begin(), source.end());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_copy(benchmark::State& state)
+{
+    const auto source = make_filled<Container>(N);
+    auto target = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        *target = *source;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_move(benchmark::State& state)
+{
+    // Move back and forth between two containers, so that the source is the full one in every iteration.
+    auto source = make_filled<Container>(N);
+    auto target = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        *target = std::move(*source);
+        std::swap(source, target);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_swap(benchmark::State& state)
+{
+    auto lhs = make_filled<Container>(N);
+    auto rhs = make_filled<Container>(N / 2);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        lhs->swap(*rhs);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_equal(benchmark::State& state)
+{
+    const auto lhs = make_filled<Container>(N);
+    const auto rhs = make_filled<Container>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(*lhs == *rhs);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_three_way(benchmark::State& state)
+{
+    const auto lhs = make_filled<Container>(N);
+    const auto rhs = make_filled<Container>(N);
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(*lhs <=> *rhs);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename Container, std::size_t N>
+void BM_erase_if(benchmark::State& state)
+{
+    // Erase every other element of a full vector, refilling it outside of the timed region.
+    using std::erase_if;
+    const auto source = make_filled<Container>(N);
+    auto vector = std::make_unique<Container>();
+    jell::bench::perf_counters counters{state, static_cast<double>(N)};
+    for (auto _ : state) {
+        state.PauseTiming();
+        counters.pause();
+        *vector = *source;
+        counters.resume();
+        state.ResumeTiming();
+        benchmark::DoNotOptimize(erase_if(*vector, [](const auto& value) { return key(value) % 2 == 0; }));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * N));
+}
+
+template <typename T, std::size_t N>
+using jell_vector = jell::inplace_vector<T, N>;
+
+#if defined(__cpp_lib_inplace_vector)
+template <typename T, std::size_t N>
+using std_inplace_vector = std::inplace_vector<T, N>;
+#endif
+
+template <template <typename, std::size_t> class Container, typename T, std::size_t N>
+void register_operations(const std::string& container, const std::string& element)
+{
+    using vector = Container<T, N>;
+
+    const auto name = [&](const std::string& operation) {
+        return operation + "/" + container + "/" + element + "/" + std::to_string(N);
+    };
+
+    benchmark::RegisterBenchmark(name("push_back").c_str(), BM_push_back<vector, N>);
+    benchmark::RegisterBenchmark(name("emplace_back").c_str(), BM_emplace_back<vector, N>);
+    benchmark::RegisterBenchmark(name("insert_erase/front").c_str(), BM_insert_erase<vector, N>, position::front);
+    benchmark::RegisterBenchmark(name("insert_erase/middle").c_str(), BM_insert_erase<vector, N>, position::middle);
+    benchmark::RegisterBenchmark(name("insert_erase/back").c_str(), BM_insert_erase<vector, N>, position::back);
+    benchmark::RegisterBenchmark(name("assign").c_str(), BM_assign<vector, N>);
+    benchmark::RegisterBenchmark(name("copy").c_str(), BM_copy<vector, N>);
+    benchmark::RegisterBenchmark(name("move").c_str(), BM_move<vector, N>);
+    benchmark::RegisterBenchmark(name("swap").c_str(), BM_swap<vector, N>);
+    benchmark::RegisterBenchmark(name("equal").c_str(), BM_equal<vector, N>);
+    benchmark::RegisterBenchmark(name("three_way").c_str(), BM_three_way<vector, N>);
+    benchmark::RegisterBenchmark(name("erase_if").c_str(), BM_erase_if<vector, N>);
+}
+
+template <typename T, std::size_t N>
+void register_containers(const std::string& element)
+{
+    register_operations<jell_vector, T, N>("inplace_vector", element);
+    register_operations<reserved_vector, T, N>("std::vector", element);
+    register_operations<array_vector, T, N>("std::array", element);
+#if defined(__cpp_lib_inplace_vector)
+    register_operations<std_inplace_vector, T, N>("std::inplace_vector", element);
+#endif
+}
+
+template <typename T>
+void register_capacities(const std::string& element)
+{
+    register_containers<T, 4>(element);
+    register_containers<T, 64>(element);
+    register_containers<T, 1024>(element);
+    register_containers<T, 65536>(element);
+}
+
+const bool registered = [] {
+    register_capacities<int>("int");
+    register_capacities<NonTrivial>("NonTrivial");
+    register_capacities<std::string>("std::string");
+    register_capacities<Pod64>("Pod64");
+    return true;
+}();
+
+} // namespace
@@ -0,0 +1,193 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#if defined(JELL_BENCH_PERF_COUNTERS) && defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#endif
+
+namespace jell::bench {
+
+#if defined(JELL_BENCH_PERF_COUNTERS) && defined(__linux__)
+
+/// Hardware performance counters (cycles, instructions, L1 data cache misses and branch misses) read with Linux's
+/// perf_event_open around the timed loop of a benchmark, and reported as benchmark counters per operation.
+/// Counters that the CPU (or virtual machine) doesn't provide are omitted. Should none be available, for example
+/// because perf_event_paranoid forbids them, a warning is printed once and the benchmark reports only its time.
+class perf_counters
+{
+public:
+    /// Open and start the counters.
+    /// @param state The state of the benchmark to which to report the counts.
+    /// @param operations The number of operations in each iteration, by which the counts are divided.
+    explicit perf_counters(benchmark::State& state, double operations = 1) noexcept
+        : state_{state}
+        , operations_{operations}
+    {
+        for (const auto& event : events) {
+            open(event);
+        }
+        if (count_ == 0) {
+            return;
+        }
+        ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        resume();
+    }
+
+    /// Stop the counters and report their counts.
+    ~perf_counters()
+    {
+        if (count_ == 0) {
+            return;
+        }
+        pause();
+
+        struct
+        {
+            std::uint64_t count;
+            std::uint64_t time_enabled;
+            std::uint64_t time_running;
+            std::uint64_t values[std::tuple_size_v<decltype(events)>];
+        } group{};
+        const auto read_ok = read(fds_[0], &group, sizeof(group)) > 0 && group.time_running != 0;
+        for (std::size_t i = 0; i != count_; ++i) {
+            close(fds_[i]);
+        }
+        if (!read_ok) {
+            return;
+        }
+
+        // Scale the counts up should the kernel have multiplexed the group with other events.
+        const auto scale = static_cast<double>(group.time_enabled) / static_cast<double>(group.time_running);
+        for (std::size_t i = 0; i != group.count; ++i) {
+            state_.counters[opened_[i]->name] = benchmark::Counter(
+                static_cast<double>(group.values[i]) * scale / operations_, benchmark::Counter::kAvgIterations);
+        }
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    /// Stop counting, for example while the benchmark's timing is paused.
+    void pause() noexcept
+    {
+        if (count_ != 0) {
+            ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    /// Resume counting.
+    void resume() noexcept
+    {
+        if (count_ != 0) {
+            ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+private:
+    struct event
+    {
+        const char* name;
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    static constexpr std::array<event, 4> events{{
+        {"cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {"instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {"L1D_misses", PERF_TYPE_HW_CACHE,
+         PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {"branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    }};
+
+    /// Whether a previous benchmark found the counters unavailable, so that the warning is printed only once.
+    inline static bool unavailable = false;
+
+    /// Open the counter for an event, as the leader of the group if it is the first. Should the leader fail to open,
+    /// no further counters are opened.
+    /// @param event The event to count.
+    void open(const event& event) noexcept
+    {
+        if (unavailable || (count_ == 0 && &event != events.data())) {
+            return;
+        }
+
+        perf_event_attr attr{};
+        attr.size           = sizeof(attr);
+        attr.type           = event.type;
+        attr.config         = event.config;
+        attr.disabled       = count_ == 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        const auto group_fd = count_ == 0 ? -1 : fds_[0];
+        const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+        if (fd == -1) {
+            if (count_ == 0) {
+                std::fprintf(stderr, "***WARNING*** perf_event_open: %s; hardware counters will not be reported\n",
+                             std::strerror(errno));
+                unavailable = true;
+            }
+            return;
+        }
+        fds_[count_]    = fd;
+        opened_[count_] = &event;
+        ++count_;
+    }
+
+    benchmark::State& state_;
+    double operations_;
+    std::array<int, std::tuple_size_v<decltype(events)>> fds_{};
+    std::array<const event*, std::tuple_size_v<decltype(events)>> opened_{};
+    std::size_t count_ = 0;
+};
+
+#else
+
+/// Without JELL_BENCH_PERF_COUNTERS (or off Linux), the counters report nothing.
+class perf_counters
+{
+public:
+    explicit perf_counters(benchmark::State&, double = 1) noexcept {}
+
+    void pause() noexcept {}
+    void resume() noexcept {}
+};
+
+#endif // JELL_BENCH_PERF_COUNTERS && __linux__
+
+} // namespace jell::bench
@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares the default whole-buffer copy of a trivially copyable inplace_vector against the opt-in size-proportional
+// copy (jell::enable_sized_copy), over a range of capacities and fill levels, to locate the crossover point.
+
+#include "inplace_vector.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+/// An int that opts in to size-proportional copying.
+struct SizedInt
+{
+    int value;
+};
+
+} // namespace
+
+namespace jell {
+
+template <std::size_t N>
+constexpr bool enable_sized_copy<SizedInt, N> = true;
+
+} // namespace jell
+
+namespace {
+
+template <typename T, std::size_t N>
+void BM_copy(benchmark::State& state)
+{
+    using vector = jell::inplace_vector<T, N>;
+
+    const auto fill = static_cast<std::size_t>(state.range(0));
+    auto source = std::make_unique<vector>();
+    auto dest = std::make_unique<vector>();
+    for (std::size_t i = 0; i != fill; ++i) {
+        source->push_back(T{static_cast<int>(i)});
+    }
+
+    jell::bench::perf_counters counters{state, static_cast<double>(fill)};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(source.get());
+        *dest = *source;
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * fill * sizeof(T)));
+}
+
+/// Fill levels of 1/64, 1/8, 1/2 and all of the capacity (and at least one element).
+template <std::size_t N>
+void fill_levels(benchmark::internal::Benchmark* benchmark)
+{
+    for (auto fill : {N / 64, N / 8, N / 2, N}) {
+        benchmark->Arg(static_cast<std::int64_t>(std::max<std::size_t>(fill, 1)));
+    }
+}
+
+#define BENCHMARK_SIZED_COPY(N)                                                     \
+    BENCHMARK(BM_copy<int, N>)->Name("copy/whole/" #N)->Apply(fill_levels<N>);      \
+    BENCHMARK(BM_copy<SizedInt, N>)->Name("copy/sized/" #N)->Apply(fill_levels<N>)
+
+BENCHMARK_SIZED_COPY(4);
+BENCHMARK_SIZED_COPY(16);
+BENCHMARK_SIZED_COPY(64);
+BENCHMARK_SIZED_COPY(256);
+BENCHMARK_SIZED_COPY(1024);
+BENCHMARK_SIZED_COPY(4096);
+BENCHMARK_SIZED_COPY(16384);
+
+} // namespace
@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Compares inplace_vector's swap, which exchanges the buffers of trivially relocatable elements a block of bytes at
+// a time, against the generic element-wise swap of the common prefix followed by moving the tail of the longer
+// vector, over a range of capacities and sizes.
+
+#include "inplace_vector.hpp"
+#include "perf_counters.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <ranges>
+
+namespace {
+
+template <typename T, std::size_t N>
+void generic_swap(jell::inplace_vector<T, N>& lhs, jell::inplace_vector<T, N>& rhs)
+{
+    auto& shorter = lhs.size() < rhs.size() ? lhs : rhs;
+    auto& longer  = lhs.size() < rhs.size() ? rhs : lhs;
+    const auto common = shorter.size();
+
+    std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+    shorter.append_range(std::ranges::subrange(longer.begin() + common, longer.end()) | std::views::as_rvalue);
+    longer.erase(longer.begin() + common, longer.end());
+}
+
+template <typename T, std::size_t N, bool Generic>
+void BM_swap(benchmark::State& state)
+{
+    using vector = jell::inplace_vector<T, N>;
+
+    // Swap a vector of the given size with one of half that size, so that both the common prefix and the tail of
+    // the longer vector are exchanged.
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto lhs = std::make_unique<vector>();
+    auto rhs = std::make_unique<vector>();
+    for (std::size_t i = 0; i != size; ++i) {
+        lhs->push_back(static_cast<T>(i));
+    }
+    for (std::size_t i = 0; i != size / 2; ++i) {
+        rhs->push_back(static_cast<T>(i));
+    }
+
+    jell::bench::perf_counters counters{state, static_cast<double>(size)};
+    for (auto _ : state) {
+        if constexpr (Generic) {
+            generic_swap(*lhs, *rhs);
+        } else {
+            lhs->swap(*rhs);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * size * sizeof(T)));
+}
+
+/// Sizes of 1/8, 1/2 and all of the capacity (and at least one element).
+template <std::size_t N>
+void sizes(benchmark::internal::Benchmark* benchmark)
+{
+    for (auto size : {N / 8, N / 2, N}) {
+        benchmark->Arg(static_cast<std::int64_t>(std::max<std::size_t>(size, 1)));
+    }
+}
+
+#define BENCHMARK_SWAP(N)                                                                   \
+    BENCHMARK(BM_swap<int, N, true>)->Name("swap/generic/" #N)->Apply(sizes<N>);            \
+    BENCHMARK(BM_swap<int, N, false>)->Name("swap/inplace_vector/" #N)->Apply(sizes<N>)
+
+BENCHMARK_SWAP(16);
+BENCHMARK_SWAP(64);
+BENCHMARK_SWAP(256);
+BENCHMARK_SWAP(1024);
+BENCHMARK_SWAP(4096);
+
+} // namespace
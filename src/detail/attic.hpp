@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "detail/config.hpp"
 #include "detail/storage.hpp"
 
 namespace jell::detail::inplace_vector {
@@ -37,7 +38,7 @@ public:
     using size_type = storage_type::size_type;
 
     /// Destructively move-construct elements in the range [save_pos..storage.size()) into the attic,
-    /// [attic_end - storage.size() + save_pos..attic_end).
+    /// [attic_end - storage.size() + save_pos..attic_end). Trivially relocatable elements are relocated in one pass.
     /// @param storage The storage in which to move elements.
     /// @param save_pos The position from which to move elements.
     /// @param attic_end The end position of the attic, into which to save elements.
@@ -54,6 +55,10 @@ public:
         {
             begin_ = save_index;
             storage_.size(begin_);
+        } else if constexpr (is_trivially_relocatable_v<T>) {
+            begin_ -= storage_.size() - save_index;
+            storage_.relocate(save_index, storage_.size(), begin_);
+            storage_.size(save_index);
         } else {
             for (; storage_.size() != save_index; --begin_) {
                 const auto last_index = storage_.size() - 1;
@@ -64,19 +69,28 @@ public:
         }
     }
 
-    /// Destroy any remaining entries in the attic (typically only during an exception).
+    /// Destroy any remaining entries in the attic (typically only during an exception). Without exceptions, the attic
+    /// is always retrieved before destruction, so there is nothing to destroy; nor is there for trivially
+    /// destructible elements, whose attic is then trivially destructible, leaving no cleanup for unwinding.
+    constexpr ~attic() requires std::is_trivially_destructible_v<T> = default;
     constexpr ~attic()
     {
+#if !defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
         storage_.destroy(begin_, end_);
+#endif
     }
 
-    /// Retrieve all elements from the attic, destructively move-constructing them if they are not already in their
-    /// required location, and adjust the storage.size().
+    /// Retrieve all elements from the attic, destructively move-constructing (or relocating) them if they are not
+    /// already in their required location, and adjust the storage.size().
     constexpr void retrieve()
     {
         if (storage_.size() == begin_) {
             begin_ = end_;
             storage_.size(end_);
+        } else if constexpr (is_trivially_relocatable_v<T>) {
+            storage_.relocate(begin_, end_, storage_.size());
+            storage_.size(storage_.size() + (end_ - begin_));
+            begin_ = end_;
         } else {
             for (; begin_ != end_; ++begin_) {
                 storage_.construct_at(storage_.size(), std::move(storage_.data()[begin_]));
@@ -86,14 +100,18 @@ public:
         }
     }
 
-    /// Check that the position is not within the bounds of the attic or above, throwing bad_alloc if the check fails.
+    /// Check whether a position is within the bounds of the attic or above, so cannot hold a new element.
     /// @param pos The position to check.
-    constexpr void capacity_check(size_type pos) const
+    /// @return Whether the position is within the attic.
+    constexpr bool contains(size_type pos) const noexcept
     {
-        if (pos >= begin_)
-        {
-            throw std::bad_alloc{};
-        }
+        return pos >= begin_;
+    }
+
+    /// @return The storage in which the elements are moved.
+    constexpr storage_type& storage() const noexcept
+    {
+        return storage_;
     }
 
 private:
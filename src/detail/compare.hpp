@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace jell::detail::inplace_vector {
+
+/// Whether an operator== for two Ts is declared, and found by argument-dependent lookup. The built-in comparison of
+/// an enumeration can't be called by name, so for an enumeration this is whether it has a user-declared operator==.
+template <typename T>
+concept has_declared_equality = requires(const T& lhs, const T& rhs) { operator==(lhs, rhs); };
+
+/// Whether two Ts are equal if and only if their object representations are equal, so may be compared with memcmp.
+/// Enumerations qualify only when compared with the built-in operator==.
+template <typename T>
+constexpr bool is_bytewise_equality_comparable_v =
+    std::is_integral_v<T> || (std::is_enum_v<T> && !has_declared_equality<T>) || std::is_pointer_v<T>;
+
+/// Whether Ts are ordered as their object representations are by memcmp, i.e. as single unsigned bytes.
+template <typename T>
+constexpr bool is_bytewise_orderable_v =
+    std::is_same_v<T, unsigned char> || std::is_same_v<T, std::byte> || std::is_same_v<T, char8_t> ||
+    std::is_same_v<T, bool> || (std::is_same_v<T, char> && std::is_unsigned_v<char>);
+
+/// Compare two element sequences of the same length for equality, with memcmp where the element type allows.
+/// @param lhs The first sequence.
+/// @param rhs The second sequence.
+/// @param count The length of both sequences.
+/// @return Whether the sequences are equal.
+template <typename T>
+constexpr bool equal(const T* lhs, const T* rhs, std::size_t count)
+{
+    if constexpr (is_bytewise_equality_comparable_v<T>) {
+        if !consteval {
+            return count == 0 || std::memcmp(lhs, rhs, count * sizeof(T)) == 0;
+        }
+    }
+    return std::equal(lhs, lhs + count, rhs);
+}
+
+/// Lexicographically compare two element sequences, with memcmp where the element type allows.
+/// @param lhs The first sequence.
+/// @param lhs_count The length of the first sequence.
+/// @param rhs The second sequence.
+/// @param rhs_count The length of the second sequence.
+/// @return The ordering of the sequences.
+template <typename T>
+constexpr auto compare_three_way(const T* lhs, std::size_t lhs_count, const T* rhs, std::size_t rhs_count)
+{
+    if constexpr (is_bytewise_orderable_v<T>) {
+        if !consteval {
+            const auto count = std::min(lhs_count, rhs_count);
+            const auto result = count == 0 ? 0 : std::memcmp(lhs, rhs, count);
+            return result != 0 ? result <=> 0 : lhs_count <=> rhs_count;
+        }
+    }
+    return std::lexicographical_compare_three_way(lhs, lhs + lhs_count, rhs, rhs + rhs_count);
+}
+
+} // namespace jell::detail::inplace_vector
@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define JELL_INPLACE_VECTOR_X86_COMPRESS 1
+#include <immintrin.h>
+#endif
+
+namespace jell::detail::inplace_vector {
+
+/// Whether the elements of a T sequence can be compacted by the vectorized kernels: 4-byte arithmetic types, whose
+/// values are moved as 32-bit lanes.
+template <typename T>
+constexpr bool is_compressible_v = std::is_arithmetic_v<T> && sizeof(T) == 4 && !std::is_same_v<T, bool>;
+
+/// Scalar reference implementation: remove the elements satisfying a predicate, keeping the order of the rest.
+/// @param data The elements.
+/// @param size The number of elements.
+/// @param predicate The predicate selecting the elements to remove.
+/// @return The number of elements kept, which are now at the start of the sequence.
+template <typename T, typename Predicate>
+constexpr std::size_t remove_if_scalar(T* data, std::size_t size, Predicate& predicate)
+{
+    return static_cast<std::size_t>(std::remove_if(data, data + size, std::ref(predicate)) - data);
+}
+
+#if defined(JELL_INPLACE_VECTOR_X86_COMPRESS)
+
+/// The mask of the elements of a block of Lanes to keep: bit i is set if element i does not satisfy the predicate.
+template <std::size_t Lanes, typename T, typename Predicate>
+[[gnu::always_inline]] inline std::uint32_t keep_mask(const T* block, Predicate& predicate)
+{
+    std::uint32_t keep = 0;
+    for (std::size_t i = 0; i != Lanes; ++i) {
+        keep |= std::uint32_t{!static_cast<bool>(std::invoke(predicate, std::as_const(block[i])))} << i;
+    }
+    return keep;
+}
+
+/// For each 8-bit keep mask, the lane indices that gather the kept lanes of a 256-bit vector to its start.
+inline constexpr auto compress_permutations = [] {
+    std::array<std::array<std::uint32_t, 8>, 256> permutations{};
+    for (std::size_t mask = 0; mask != permutations.size(); ++mask) {
+        std::size_t dest = 0;
+        for (std::uint32_t lane = 0; lane != 8; ++lane) {
+            if (mask & (1u << lane)) {
+                permutations[mask][dest++] = lane;
+            }
+        }
+    }
+    return permutations;
+}();
+
+/// AVX2 implementation of remove_if_scalar(), compacting 8 elements at a time with a permutation table.
+/// Each block is loaded before its compacted form is stored, and the store, of the full block width, never reaches
+/// beyond the block being read, so the compaction can be done in place.
+template <typename T, typename Predicate>
+[[gnu::target("avx2")]] std::size_t remove_if_avx2(T* data, std::size_t size, Predicate& predicate)
+{
+    constexpr std::size_t lanes = 8;
+    auto* dest = data;
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        const auto keep = keep_mask<lanes>(data + i, predicate);
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto permutation =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(compress_permutations[keep].data()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_permutevar8x32_epi32(block, permutation));
+        dest += std::popcount(keep);
+    }
+    const auto tail = remove_if_scalar(data + i, size - i, predicate);
+    if (dest != data + i) {
+        std::memmove(dest, data + i, tail * sizeof(T));
+    }
+    return static_cast<std::size_t>(dest - data) + tail;
+}
+
+/// AVX-512 implementation of remove_if_scalar(), compacting 16 elements at a time with vpcompressd.
+template <typename T, typename Predicate>
+[[gnu::target("avx512f")]] std::size_t remove_if_avx512(T* data, std::size_t size, Predicate& predicate)
+{
+    constexpr std::size_t lanes = 16;
+    auto* dest = data;
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        const auto keep = static_cast<__mmask16>(keep_mask<lanes>(data + i, predicate));
+        const auto block = _mm512_loadu_si512(data + i);
+        _mm512_storeu_si512(dest, _mm512_maskz_compress_epi32(keep, block));
+        dest += std::popcount(static_cast<unsigned>(keep));
+    }
+    const auto tail = remove_if_scalar(data + i, size - i, predicate);
+    if (dest != data + i) {
+        std::memmove(dest, data + i, tail * sizeof(T));
+    }
+    return static_cast<std::size_t>(dest - data) + tail;
+}
+
+#endif // JELL_INPLACE_VECTOR_X86_COMPRESS
+
+/// Remove the elements satisfying a predicate, keeping the order of the rest, with the widest compaction kernel the
+/// CPU supports. The predicate is invoked once for each element, in order. The vectorized kernels pass the elements
+/// as const lvalues, so a predicate that takes them by non-const reference is left to remove_if_scalar().
+/// @param data The elements.
+/// @param size The number of elements.
+/// @param predicate The predicate selecting the elements to remove.
+/// @return The number of elements kept, which are now at the start of the sequence.
+template <typename T, typename Predicate>
+    requires is_compressible_v<T>
+std::size_t remove_if(T* data, std::size_t size, Predicate& predicate)
+{
+#if defined(JELL_INPLACE_VECTOR_X86_COMPRESS)
+    if constexpr (std::predicate<Predicate&, const T&>) {
+        if (__builtin_cpu_supports("avx512f")) {
+            return remove_if_avx512(data, size, predicate);
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return remove_if_avx2(data, size, predicate);
+        }
+    }
+#endif
+    return remove_if_scalar(data, size, predicate);
+}
+
+} // namespace jell::detail::inplace_vector
@@ -0,0 +1,82 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstdlib>
+#include <utility>
+
+// Define JELL_INPLACE_VECTOR_NO_EXCEPTIONS to build without exceptions; it is defined automatically when exceptions
+// are disabled (e.g. by -fno-exceptions). Every operation then compiles without try, catch or throw: errors that would
+// throw are instead reported to the error handler (see jell::set_error_handler), and the bookkeeping that restores
+// invariants while unwinding is omitted.
+#if !defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS) && !defined(__cpp_exceptions)
+#define JELL_INPLACE_VECTOR_NO_EXCEPTIONS 1
+#endif
+
+// try, catch (...) and rethrow, which compile away without exceptions. Only for use within templates, so that the
+// handler is discarded.
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+#define JELL_INPLACE_VECTOR_TRY if constexpr (true)
+#define JELL_INPLACE_VECTOR_CATCH_ALL else
+#define JELL_INPLACE_VECTOR_RETHROW static_cast<void>(0)
+#else
+#define JELL_INPLACE_VECTOR_TRY try
+#define JELL_INPLACE_VECTOR_CATCH_ALL catch (...)
+#define JELL_INPLACE_VECTOR_RETHROW throw
+#endif
+
+namespace jell {
+
+/// A handler for the errors that would otherwise throw, in builds without exceptions. The handler must not return.
+using error_handler = void (*)(const char* message) noexcept;
+
+namespace detail::inplace_vector {
+
+[[noreturn]] inline void default_error_handler(const char*) noexcept
+{
+    std::abort();
+}
+
+inline error_handler current_error_handler = &default_error_handler;
+
+/// Report an error to the error handler, aborting should the handler return.
+/// @param message A description of the error.
+[[noreturn]] inline void report_error(const char* message) noexcept
+{
+    current_error_handler(message);
+    std::abort();
+}
+
+} // namespace detail::inplace_vector
+
+/// Set the handler for the errors that would otherwise throw, in builds without exceptions. The default handler
+/// calls std::abort().
+/// @param handler The new handler, or nullptr to restore the default.
+/// @return The previous handler.
+inline error_handler set_error_handler(error_handler handler) noexcept
+{
+    return std::exchange(detail::inplace_vector::current_error_handler,
+                         handler != nullptr ? handler : &detail::inplace_vector::default_error_handler);
+}
+
+} // namespace jell
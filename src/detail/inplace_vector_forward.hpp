@@ -22,13 +22,14 @@
 
 #pragma once
 
+#include "detail/overflow_policy.hpp"
+
 #include <cstddef>
 #include <type_traits>
 
 namespace jell {
 
-template <typename T, std::size_t N>
-    requires std::is_move_constructible_v<T> && std::is_move_assignable_v<T>
+template <typename T, std::size_t N, typename Policy = throw_on_overflow>
 class inplace_vector;
 
 } // namespace jell
@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/attic.hpp"
+#include "detail/config.hpp"
+#include "detail/storage.hpp"
+#include "detail/traits.hpp"
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace jell::detail::inplace_vector {
+
+/// A gap-buffer cursor for repeated insertion at one position. The elements from the insertion position onwards are
+/// moved into an attic at the top of the storage once, on construction; any number of elements may then be emplaced
+/// at the cursor, each in O(1); and the attic elements are moved back down once, on commit() or destruction.
+/// While the session is open, the vector must not otherwise be accessed.
+/// @tparam Policy The capacity-overflow policy (see jell::throw_on_overflow).
+template <typename T, std::size_t N, typename Policy>
+class insertion_session
+{
+private:
+    using storage_type = detail::inplace_vector::storage<T, N>;
+    using attic_type   = detail::inplace_vector::attic<T, N>;
+
+public:
+    using size_type       = storage_type::size_type;
+    using value_type      = storage_type::value_type;
+    using pointer         = value_type*;
+
+    /// Open the gap at pos, moving the elements [pos..storage.size()) to the top of the storage.
+    /// @param storage The storage into which to insert.
+    /// @param pos The insertion position.
+    template <std::random_access_iterator Iterator>
+    constexpr insertion_session(storage_type& storage, Iterator pos)
+        : attic_{storage, pos, N}
+    {
+        if constexpr (!always_retrieve) {
+            if !consteval {
+                uncaught_exceptions_ = std::uncaught_exceptions();
+            }
+        }
+    }
+
+    insertion_session(const insertion_session&) = delete;
+    insertion_session& operator=(const insertion_session&) = delete;
+
+    /// Close the gap, unless the session is being destroyed by a new exception, in which case the attic elements are
+    /// destroyed, as with any other failed insertion. Trivially relocatable elements are retrieved without throwing,
+    /// so they are always retrieved.
+    constexpr ~insertion_session() noexcept(std::is_nothrow_move_constructible_v<T> || is_trivially_relocatable_v<T>)
+    {
+        if constexpr (always_retrieve) {
+            attic_.retrieve();
+        } else {
+            if consteval {
+                attic_.retrieve();
+            } else {
+                if (std::uncaught_exceptions() == uncaught_exceptions_) {
+                    attic_.retrieve();
+                }
+            }
+        }
+    }
+
+    /// Construct an element at the cursor, and advance the cursor past it.
+    /// If the gap is full, the overflow policy is invoked, and the session remains open.
+    /// @param args The arguments with which to construct the element.
+    /// @return A pointer to the new element, or nullptr if the policy saturated, dropping the element.
+    template <typename... Args>
+    constexpr pointer emplace(Args&&... args)
+    {
+        auto& storage = attic_.storage();
+        const auto pos = storage.size();
+        if (attic_.contains(pos)) {
+            Policy::on_overflow();
+            return nullptr;
+        }
+        const auto element = storage.construct_at(pos, std::forward<Args>(args)...);
+        storage.size(pos + 1);
+        return element;
+    }
+
+    constexpr pointer insert(const value_type& value)
+    {
+        return emplace(value);
+    }
+
+    constexpr pointer insert(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Close the gap, moving the attic elements back down to follow the inserted elements.
+    /// The session may not be used after being committed.
+    constexpr void commit()
+    {
+        attic_.retrieve();
+    }
+
+private:
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+    static constexpr bool always_retrieve = true;
+#else
+    static constexpr bool always_retrieve = is_trivially_relocatable_v<T>;
+#endif
+
+    /// The exception count need not be tracked when the attic is always retrieved.
+    struct untracked {};
+
+    attic_type attic_;
+    [[no_unique_address]] std::conditional_t<always_retrieve, untracked, int> uncaught_exceptions_{};
+};
+
+} // namespace jell::detail::inplace_vector
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "detail/config.hpp"
 #include "detail/inplace_vector_forward.hpp"
 
 #include <iterator>
@@ -38,8 +39,7 @@ class iterator
 private:
     friend iterator<std::add_const_t<T>>;
 
-    template <typename U, std::size_t N>
-        requires std::is_move_constructible_v<U> && std::is_move_assignable_v<U>
+    template <typename U, std::size_t N, typename Policy>
     friend class ::jell::inplace_vector;
 
     static constexpr inline bool is_const_iterator = std::is_const_v<T>;
@@ -181,7 +181,11 @@ private:
     {
 #if defined(CHECKED_ITERATORS)
         if (pos < first_ || pos >= last_) {
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+            report_error(message);
+#else
             throw std::range_error(message);
+#endif
         }
 #endif
     }
@@ -190,7 +194,11 @@ private:
     {
 #if defined(CHECKED_ITERATORS)
         if (pos < first_ || pos > last_) {
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+            report_error(message);
+#else
             throw std::range_error(message);
+#endif
         }
 #endif
     }
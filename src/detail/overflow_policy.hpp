@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include "detail/config.hpp"
+
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+namespace jell {
+
+/// Capacity-overflow policies for inplace_vector<T, N, Policy>.
+/// Whenever an operation would take an inplace_vector beyond its capacity, it calls Policy::on_overflow() before
+/// modifying the vector. Should on_overflow() return, the operation saturates: elements that do not fit are dropped.
+/// emplace_back() and push_back(), which must return a reference, then return an unspecified reference that must not
+/// be used, so they are unavailable for a zero-capacity vector with such a policy (see overflow_saturates).
+
+/// Throw std::bad_alloc (the default). Without exceptions, report the error to the error handler instead.
+struct throw_on_overflow
+{
+    [[noreturn]] static void on_overflow()
+    {
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+        detail::inplace_vector::report_error("inplace_vector capacity exceeded");
+#else
+        throw std::bad_alloc{};
+#endif
+    }
+};
+
+/// Call std::abort().
+struct abort_on_overflow
+{
+    [[noreturn]] static void on_overflow() noexcept { std::abort(); }
+};
+
+/// Execute a trap instruction, for the smallest possible code at each check.
+struct trap_on_overflow
+{
+    [[noreturn]] static void on_overflow() noexcept { __builtin_trap(); }
+};
+
+/// Silently drop the elements that do not fit.
+struct saturate_on_overflow
+{
+    static constexpr void on_overflow() noexcept {}
+};
+
+/// Call a user-provided handler, which may throw, terminate, or return to saturate.
+/// @tparam Handler The handler, invocable with no arguments.
+template <auto Handler>
+struct call_on_overflow
+{
+    static constexpr void on_overflow() { std::invoke(Handler); }
+};
+
+/// Whether Policy::on_overflow() may return, saturating the operation. Specialize as false for a custom policy whose
+/// on_overflow() never returns.
+template <typename Policy>
+constexpr bool overflow_saturates = true;
+
+template <>
+constexpr bool overflow_saturates<throw_on_overflow> = false;
+
+template <>
+constexpr bool overflow_saturates<abort_on_overflow> = false;
+
+template <>
+constexpr bool overflow_saturates<trap_on_overflow> = false;
+
+} // namespace jell
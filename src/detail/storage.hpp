@@ -22,19 +22,85 @@
 
 #pragma once
 
+#include "detail/config.hpp"
+#include "detail/traits.hpp"
+
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
 
 namespace jell::detail::inplace_vector {
 
+/// The smallest unsigned integer type that can hold every size in [0..N].
+template <std::size_t N>
+using compact_size_t =
+    std::conditional_t<N <= std::numeric_limits<std::uint8_t>::max(),  std::uint8_t,
+    std::conditional_t<N <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+    std::conditional_t<N <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t,
+                                                                         std::size_t>>>;
+
+/// Uninitialized storage for N elements of type T.
+/// The union suppresses construction and destruction of the elements, which the storage instead constructs and
+/// destroys individually. Unlike a std::byte buffer, the elements are accessed without a reinterpret_cast, so they
+/// can be used in constant expressions.
+template <typename T, std::size_t N>
+union uninitialized_array
+{
+    struct value_initialize_t { explicit value_initialize_t() = default; };
+
+    constexpr uninitialized_array() noexcept {}
+
+    /// Value-initialize all of the elements, making them the active member of the union.
+    constexpr explicit uninitialized_array(value_initialize_t) noexcept : elements{} {}
+
+    // Copies and moves are trivial for trivial elements, and are otherwise deleted (and performed by the storage).
+    constexpr uninitialized_array(const uninitialized_array&) = default;
+    constexpr uninitialized_array(uninitialized_array&&) = default;
+    constexpr uninitialized_array& operator=(const uninitialized_array&) = default;
+    constexpr uninitialized_array& operator=(uninitialized_array&&) = default;
+
+    constexpr ~uninitialized_array() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~uninitialized_array() {}
+
+    T elements[N];
+};
+
+/// Exchange two non-overlapping byte ranges a block at a time. Both blocks are loaded before either is stored, so
+/// that each is moved with wide loads and stores, without a round trip through memory.
+/// @param lhs The first byte range.
+/// @param rhs The second byte range.
+/// @param count The number of bytes to exchange.
+inline void swap_bytes(std::byte* lhs, std::byte* rhs, std::size_t count) noexcept
+{
+    constexpr std::size_t block_size = 32;
+
+    for (; count >= block_size; count -= block_size, lhs += block_size, rhs += block_size) {
+        std::byte lhs_block[block_size];
+        std::byte rhs_block[block_size];
+        std::memcpy(lhs_block, lhs, block_size);
+        std::memcpy(rhs_block, rhs, block_size);
+        std::memcpy(lhs, rhs_block, block_size);
+        std::memcpy(rhs, lhs_block, block_size);
+    }
+    std::swap_ranges(lhs, lhs + count, rhs);
+}
+
 /// Storage for the inplace_vector.
+/// The element count is held in the smallest unsigned type that can represent N, but is exposed as a size_type.
 /// @tparam T The element type.
 /// @tparam N The number of elements to allocate in the storage.
 template <typename T, std::size_t N>
 class storage
 {
+    static_assert(!enable_sized_copy<T, N> || std::is_trivially_copyable_v<T>,
+                  "enable_sized_copy requires a trivially copyable element type");
+
 public:
     using size_type       = std::size_t;
     using difference_type = std::ptrdiff_t;
@@ -42,22 +108,47 @@ public:
     using pointer         = T*;
     using const_pointer   = const T*;
 
-    constexpr storage() noexcept = default;
+    constexpr storage() noexcept
+    {
+        if consteval {
+            // Constant evaluation requires that trivial elements be within their lifetime before being assigned.
+            if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_copy_assignable_v<T> &&
+                          std::is_trivially_destructible_v<T>) {
+                data_ = elements_type{typename elements_type::value_initialize_t{}};
+            }
+        }
+    }
 
-    constexpr storage(const storage&) noexcept requires std::is_trivially_copy_constructible_v<T> = default;
+    constexpr storage(const storage&) noexcept
+        requires copy_constructible_element<T> && std::is_trivially_copy_constructible_v<T> &&
+                 (!enable_sized_copy<T, N>) = default;
+    constexpr storage(const storage& other) noexcept
+        requires copy_constructible_element<T> && enable_sized_copy<T, N>
+    {
+        sized_copy(other);
+    }
     constexpr storage(const storage& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires copy_constructible_element<T>
     {
-        exception_guard([&] {
+        exception_guard([&] noexcept(std::is_nothrow_copy_constructible_v<T>) {
             for (; size_ != other.size_; ++size_) {
                 construct_at(size_, other.data()[size_]);
             }
         });
     }
 
-    constexpr storage(storage&&) noexcept requires std::is_trivially_move_constructible_v<T> = default;
+    constexpr storage(storage&&) noexcept
+        requires move_constructible_element<T> && std::is_trivially_move_constructible_v<T> &&
+                 (!enable_sized_copy<T, N>) = default;
+    constexpr storage(storage&& other) noexcept
+        requires move_constructible_element<T> && enable_sized_copy<T, N>
+    {
+        sized_copy(other);
+    }
     constexpr storage(storage&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires move_constructible_element<T>
     {
-        exception_guard([&] {
+        exception_guard([&] noexcept(std::is_nothrow_move_constructible_v<T>) {
             for (; size_ != other.size_; ++size_) {
                 construct_at(size_, std::move(other.data()[size_]));
             }
@@ -70,8 +161,19 @@ public:
         clear();
     }
 
-    constexpr storage& operator=(const storage&) noexcept requires std::is_trivially_copy_assignable_v<T> = default;
+    constexpr storage& operator=(const storage&) noexcept
+        requires copy_assignable_element<T> && std::is_trivially_copy_assignable_v<T> &&
+                 (!enable_sized_copy<T, N>) = default;
+    constexpr storage& operator=(const storage& other) noexcept
+        requires copy_assignable_element<T> && enable_sized_copy<T, N>
+    {
+        if (this != &other) {
+            sized_copy(other);
+        }
+        return *this;
+    }
     constexpr storage& operator=(const storage& other) noexcept(std::is_nothrow_copy_assignable_v<T>)
+        requires copy_assignable_element<T>
     {
         if (size_ > other.size_) {
             destroy(other.size_, size_);
@@ -86,8 +188,19 @@ public:
         return *this;
     }
 
-    constexpr storage& operator=(storage&&) noexcept requires std::is_trivially_move_assignable_v<T> = default;
+    constexpr storage& operator=(storage&&) noexcept
+        requires move_assignable_element<T> && std::is_trivially_move_assignable_v<T> &&
+                 (!enable_sized_copy<T, N>) = default;
+    constexpr storage& operator=(storage&& other) noexcept
+        requires move_assignable_element<T> && enable_sized_copy<T, N>
+    {
+        if (this != &other) {
+            sized_copy(other);
+        }
+        return *this;
+    }
     constexpr storage& operator=(storage&& other) noexcept(std::is_nothrow_move_assignable_v<T>)
+        requires move_assignable_element<T>
     {
         if (size_ > other.size_) {
             destroy(other.size_, size_);
@@ -99,14 +212,14 @@ public:
         for (; size_ < other.size_; ++size_) {
             construct_at(size_, std::move(other.data()[size_]));
         }
-        other.size_ = 0;
+        other.clear();
         return *this;
     }
 
-    [[nodiscard]] constexpr pointer       data()       noexcept { return reinterpret_cast<T*>(data_); }
-    [[nodiscard]] constexpr const_pointer data() const noexcept { return reinterpret_cast<const T*>(data_); }
+    [[nodiscard]] constexpr pointer       data()       noexcept { return data_.elements; }
+    [[nodiscard]] constexpr const_pointer data() const noexcept { return data_.elements; }
     [[nodiscard]] constexpr size_type     size() const          { return size_; }
-                  constexpr void          size(size_type n)     { size_ = n; }
+                  constexpr void          size(size_type n)     { size_ = static_cast<stored_size_type>(n); }
 
     template <typename... Args>
     constexpr pointer construct_at(size_type i, Args&&... args)
@@ -114,6 +227,91 @@ public:
         return std::ranges::construct_at(data() + i, std::forward<Args>(args)...);
     }
 
+    /// Copy-construct count copies of value at the end of the storage, committing the size once.
+    /// Should a construction throw, the new elements are destroyed and the size is unchanged.
+    /// @param count The number of elements to construct.
+    /// @param value The value to copy.
+    constexpr void uninitialized_fill_n(size_type count, const value_type& value)
+    {
+        append_n(count, [&](pointer p) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+            std::ranges::construct_at(p, value);
+        });
+    }
+
+    /// Value-initialize count elements at the end of the storage, committing the size once.
+    /// Should a construction throw, the new elements are destroyed and the size is unchanged.
+    /// @param count The number of elements to construct.
+    constexpr void uninitialized_value_construct_n(size_type count)
+    {
+        append_n(count, [](pointer p) noexcept(std::is_nothrow_default_constructible_v<T>) {
+            std::ranges::construct_at(p);
+        });
+    }
+
+    /// Construct count elements at the end of the storage from the elements of an input sequence (moving from it if
+    /// it yields rvalues), committing the size once. Trivially copyable elements of a contiguous sequence are copied
+    /// with a single memcpy. Should a construction throw, the new elements are destroyed and the size is unchanged.
+    /// @param first The start of the input sequence.
+    /// @param count The number of elements to construct.
+    /// @return The input iterator following the last element constructed.
+    template <std::input_iterator InputIt>
+    constexpr InputIt uninitialized_copy_n(InputIt first, size_type count)
+    {
+        if constexpr (std::contiguous_iterator<InputIt> &&
+                      std::is_same_v<std::iter_value_t<InputIt>, value_type> &&
+                      std::is_trivially_copyable_v<value_type>) {
+            if !consteval {
+                // An empty source may be a null pointer, which memcpy must not be given even for zero bytes.
+                if (count != 0) {
+                    std::memcpy(static_cast<void*>(data() + size_),
+                                static_cast<const void*>(std::to_address(first)),
+                                count * sizeof(value_type));
+                    size_ = static_cast<stored_size_type>(size_ + count);
+                }
+                return first + static_cast<std::iter_difference_t<InputIt>>(count);
+            }
+        }
+        append_n(count, [&](pointer p) {
+            std::ranges::construct_at(p, *first);
+            ++first;
+        });
+        return first;
+    }
+
+    /// Move-construct count elements at the end of the storage from the elements of an input sequence, committing
+    /// the size once. Should a construction throw, the new elements are destroyed and the size is unchanged.
+    /// @param first The start of the input sequence.
+    /// @param count The number of elements to construct.
+    /// @return The input iterator following the last element constructed.
+    template <std::input_iterator InputIt>
+    constexpr InputIt uninitialized_move_n(InputIt first, size_type count)
+    {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            return uninitialized_copy_n(std::move(first), count);
+        } else {
+            append_n(count, [&](pointer p) {
+                std::ranges::construct_at(p, std::ranges::iter_move(first));
+                ++first;
+            });
+            return first;
+        }
+    }
+
+    /// Default-initialize the elements [first..last), leaving trivially default constructible elements uninitialized.
+    /// @param first The index of the first element to initialize.
+    /// @param last The index one past the last element to initialize.
+    constexpr void default_construct(size_type first, size_type last)
+    {
+        if consteval {
+            // Constant evaluation has no uninitialized values, so value-initialize instead.
+            for (; first != last; ++first) {
+                construct_at(first);
+            }
+        } else {
+            std::uninitialized_default_construct(data() + first, data() + last);
+        }
+    }
+
     constexpr void destroy_at(size_type)   noexcept requires std::is_trivially_destructible_v<T> {}
     constexpr void destroy_at(size_type i) noexcept
     {
@@ -132,20 +330,165 @@ public:
         size_ = 0;
     }
 
+    /// Relocate the elements [first..last) to [dest..dest + last - first) with a single memmove. The ranges may
+    /// overlap. The source elements are left destroyed, and the size() is not modified.
+    /// @param first The index of the first element to relocate.
+    /// @param last The index one past the last element to relocate.
+    /// @param dest The index to which to relocate the first element.
+    constexpr void relocate(size_type first, size_type last, size_type dest) noexcept
+        requires is_trivially_relocatable_v<T>
+    {
+        if consteval {
+            if (dest < first) {
+                for (; first != last; ++first, ++dest) {
+                    construct_at(dest, std::move(data()[first]));
+                    destroy_at(first);
+                }
+            } else if (dest > first) {
+                for (dest += last - first; first != last; --last) {
+                    construct_at(--dest, std::move(data()[last - 1]));
+                    destroy_at(last - 1);
+                }
+            }
+        } else {
+            if (first != last) {
+                std::memmove(static_cast<void*>(data() + dest),
+                             static_cast<const void*>(data() + first),
+                             (last - first) * sizeof(value_type));
+            }
+        }
+    }
+
+    /// Move the elements [first..other.size()) of another storage to the end of this storage, leaving the other
+    /// storage with its first elements. Trivially relocatable elements are relocated with a single memcpy; other
+    /// elements are move-constructed, and should a construction throw, this storage is unchanged.
+    /// @param other The storage from which to move the elements.
+    /// @param first The index of the first element to move.
+    template <std::size_t M>
+    constexpr void splice_from(storage<T, M>& other, size_type first)
+        noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        const auto count = other.size() - first;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if !consteval {
+                if (count != 0) {
+                    std::memcpy(static_cast<void*>(data() + size_),
+                                static_cast<const void*>(other.data() + first),
+                                count * sizeof(value_type));
+                    size_ = static_cast<stored_size_type>(size_ + count);
+                    other.size(first);
+                }
+                return;
+            }
+        }
+        uninitialized_move_n(other.data() + first, count);
+        other.destroy(first, other.size());
+        other.size(first);
+    }
+
+    /// Swap the contents of two storages of trivially relocatable elements: the bytes of the common prefix are
+    /// exchanged a block at a time, the remaining elements of the longer storage are copied into the shorter, and the
+    /// sizes are exchanged. No element is constructed or destroyed.
+    /// @param other The storage with which to swap.
+    constexpr void swap(storage& other) noexcept requires is_trivially_relocatable_v<T>
+    {
+        const auto common = std::min<size_type>(size_, other.size_);
+        auto& shorter = size_ < other.size_ ? *this : other;
+        auto& longer  = size_ < other.size_ ? other : *this;
+
+        if consteval {
+            std::swap_ranges(data(), data() + common, other.data());
+            for (auto i = common; i != longer.size(); ++i) {
+                shorter.construct_at(i, std::move(longer.data()[i]));
+                longer.destroy_at(i);
+            }
+        } else {
+            const auto common_bytes = common * sizeof(value_type);
+            swap_bytes(bytes(), other.bytes(), common_bytes);
+            if (longer.size() != common) {
+                std::memcpy(shorter.bytes() + common_bytes,
+                            longer.bytes() + common_bytes,
+                            (longer.size() - common) * sizeof(value_type));
+            }
+        }
+        std::swap(size_, other.size_);
+    }
+
+    /// Invoke a function that constructs elements, destroying every element should it throw. The guard is omitted
+    /// when there is nothing to undo: when the function cannot throw, or the elements are trivially destructible.
+    /// @param function The function to invoke.
+    /// @param args The arguments with which to invoke the function.
     template <typename Function, typename... Args>
     constexpr void exception_guard(Function&& function, Args&&... args)
     {
-        try {
+        if constexpr (std::is_nothrow_invocable_v<Function, Args...> || std::is_trivially_destructible_v<T>) {
             std::invoke(std::forward<Function>(function), std::forward<Args>(args)...);
-        } catch (...) {
-            destroy(0, size_);
-            throw;
+        } else {
+            JELL_INPLACE_VECTOR_TRY {
+                std::invoke(std::forward<Function>(function), std::forward<Args>(args)...);
+            } JELL_INPLACE_VECTOR_CATCH_ALL {
+                destroy(0, size_);
+                JELL_INPLACE_VECTOR_RETHROW;
+            }
         }
     }
 
 private:
-    alignas(value_type) std::byte data_[N * sizeof(value_type)];
-    size_type size_{0};
+    using stored_size_type = compact_size_t<N>;
+
+    /// Construct count elements at the end of the storage, then commit the size once. Should a construction throw,
+    /// the elements already constructed are destroyed and the size is unchanged. As with exception_guard(), the
+    /// rollback is omitted when there is nothing to undo.
+    /// @param count The number of elements to construct.
+    /// @param construct The function with which to construct each element, given a pointer to its storage.
+    template <typename Construct>
+    constexpr void append_n(size_type count, Construct&& construct)
+    {
+        const size_type first = size_;
+        const size_type last  = first + count;
+        if constexpr (std::is_nothrow_invocable_v<Construct&, pointer> || std::is_trivially_destructible_v<T>) {
+            for (auto i = first; i != last; ++i) {
+                construct(data() + i);
+            }
+        } else {
+            auto i = first;
+            JELL_INPLACE_VECTOR_TRY {
+                for (; i != last; ++i) {
+                    construct(data() + i);
+                }
+            } JELL_INPLACE_VECTOR_CATCH_ALL {
+                destroy(first, i);
+                JELL_INPLACE_VECTOR_RETHROW;
+            }
+        }
+        size_ = static_cast<stored_size_type>(last);
+    }
+
+    /// Copy only the live elements of a trivially copyable storage.
+    /// @param other The storage from which to copy.
+    constexpr void sized_copy(const storage& other) noexcept
+    {
+        if consteval {
+            for (size_type i = 0; i != other.size_; ++i) {
+                construct_at(i, other.data()[i]);
+            }
+        } else {
+            if (other.size_ != 0) {
+                std::memcpy(static_cast<void*>(data()),
+                            static_cast<const void*>(other.data()),
+                            other.size_ * sizeof(value_type));
+            }
+        }
+        size_ = other.size_;
+    }
+
+    /// The object representation of the elements, for use outside of constant evaluation.
+    [[nodiscard]] std::byte* bytes() noexcept { return static_cast<std::byte*>(static_cast<void*>(data())); }
+
+    using elements_type = uninitialized_array<T, N>;
+
+    elements_type data_;
+    stored_size_type size_{0};
 };
 
 /// Storage specialization for a zero-sized inplace_vector.
@@ -166,9 +509,24 @@ struct storage<T, 0>
     template <typename... Args>
     constexpr T* construct_at(size_type, Args&&...) noexcept { return nullptr; }
 
+    constexpr void uninitialized_fill_n(size_type, const value_type&) noexcept {}
+    constexpr void uninitialized_value_construct_n(size_type) noexcept {}
+
+    template <std::input_iterator InputIt>
+    constexpr InputIt uninitialized_copy_n(InputIt first, size_type) noexcept { return first; }
+
+    template <std::input_iterator InputIt>
+    constexpr InputIt uninitialized_move_n(InputIt first, size_type) noexcept { return first; }
+
+    constexpr void default_construct(size_type, size_type) noexcept {}
     constexpr void destroy_at(size_type) noexcept {}
     constexpr void destroy(size_type, size_type) noexcept {}
     constexpr void clear() noexcept {}
+    constexpr void relocate(size_type, size_type, size_type) noexcept {}
+
+    template <std::size_t M>
+    constexpr void splice_from(storage<T, M>&, size_type) noexcept {}
+    constexpr void swap(storage&) noexcept {}
 
     template <typename Function, typename... Args>
     constexpr void exception_guard(Function&&, Args&&...) {}
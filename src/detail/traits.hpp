@@ -0,0 +1,73 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+namespace jell {
+
+/// Opt in to size-proportional copying for inplace_vector<T, N>.
+/// By default, a trivially copyable T makes the inplace_vector trivially copyable, and a copy or move transfers the
+/// whole N-element buffer. Specializing this variable to true instead copies only the live elements with a single
+/// memcpy, at the cost of the inplace_vector no longer being trivially copyable. T must be trivially copyable.
+/// @tparam T The element type.
+/// @tparam N The capacity of the inplace_vector.
+template <typename T, std::size_t N>
+constexpr bool enable_sized_copy = false;
+
+/// Whether T is trivially relocatable: moving a T to a new address and destroying the original is equivalent to
+/// copying its bytes. inplace_vector then relocates contiguous runs of elements with memmove rather than by
+/// move-construction and destruction of each element. Trivially copyable types are trivially relocatable; specialize
+/// this trait for other types, such as owning handles, that do not hold pointers into themselves.
+/// @tparam T The element type.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename T>
+constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+namespace detail::inplace_vector {
+
+// The element requirements of the storage's copy and move operations. These are concepts, rather than traits, so that
+// the more constrained trivial and sized overloads are preferred by subsumption.
+template <typename T>
+concept copy_constructible_element = std::is_copy_constructible_v<T>;
+
+template <typename T>
+concept move_constructible_element = std::is_move_constructible_v<T>;
+
+template <typename T>
+concept copy_assignable_element = copy_constructible_element<T> && std::is_copy_assignable_v<T>;
+
+template <typename T>
+concept move_assignable_element = move_constructible_element<T> && std::is_move_assignable_v<T>;
+
+/// The element requirement of the operations that move elements within a vector: insertion, erasure and swap.
+/// Non-movable elements, such as atomics and mutexes, are otherwise supported.
+template <typename T>
+concept movable_element = move_assignable_element<T>;
+
+} // namespace detail::inplace_vector
+
+} // namespace jell
@@ -23,26 +23,65 @@
 #pragma once
 
 #include "detail/attic.hpp"
+#include "detail/compare.hpp"
+#include "detail/compress.hpp"
+#include "detail/config.hpp"
 #include "detail/container_compatible_range.hpp"
+#include "detail/inplace_vector_forward.hpp"
+#include "detail/insertion_session.hpp"
 #include "detail/iterator.hpp"
+#include "detail/overflow_policy.hpp"
 #include "detail/storage.hpp"
 
 #include <algorithm>
+#include <expected>
 #include <format>
+#include <functional>
+#include <utility>
 
 namespace jell {
 
+/// Tag selecting default-initialization, rather than value-initialization, of new elements. Elements of trivially
+/// default constructible types are left uninitialized.
+struct default_init_t { explicit default_init_t() = default; };
+inline constexpr default_init_t default_init{};
+
+/// The errors reported by the non-throwing try_* operations.
+enum class inplace_vector_errc
+{
+    capacity_exceeded = 1, ///< The operation would exceed the capacity.
+    out_of_range,          ///< The position is not that of an element.
+};
+
+namespace detail::inplace_vector {
+
+/// Access to the storage of a vector, for the free functions that move elements between vectors.
+struct storage_access
+{
+    template <typename Vector>
+    static constexpr auto& get(Vector& v) noexcept
+    {
+        return v.storage_;
+    }
+};
+
+} // namespace detail::inplace_vector
+
 /// A dynamically-resizable array with contiguous inplace storage.
 /// @tparam T The element type.
 /// @tparam N The maximum number of elements that can be stored in the container.
-template <typename T, std::size_t N>
-    requires std::is_move_constructible_v<T> && std::is_move_assignable_v<T>
+/// @tparam Policy The capacity-overflow policy: throw_on_overflow (the default), abort_on_overflow, trap_on_overflow,
+///                saturate_on_overflow, or call_on_overflow<Handler>.
+template <typename T, std::size_t N, typename Policy>
 class inplace_vector
 {
 private:
     using storage_type           = detail::inplace_vector::storage<T, N>;
     using attic_type             = detail::inplace_vector::attic<T, N>;
 
+    template <typename U>
+    using expected               = std::expected<U, inplace_vector_errc>;
+
 public:
     using size_type              = storage_type::size_type;
     using difference_type        = storage_type::difference_type;
@@ -55,47 +94,93 @@ public:
     using const_iterator         = detail::inplace_vector::iterator<const T>;
     using reverse_iterator       = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using insertion_session      = detail::inplace_vector::insertion_session<T, N, Policy>;
 
     constexpr inplace_vector() noexcept = default;
 
     constexpr explicit inplace_vector(size_type count)
     {
-        capacity_check(count);
-        storage_.exception_guard([&] {
-            while (count--) {
-                unchecked_emplace_back();
-            }
-        });
+        storage_.uninitialized_value_construct_n(capacity_check(count));
+    }
+
+    constexpr inplace_vector(size_type count, default_init_t)
+    {
+        resize(count, default_init);
     }
 
     constexpr inplace_vector(size_type count, const value_type& value)
     {
-        capacity_check(count);
-        storage_.exception_guard([&] {
-            while (count--) {
-                unchecked_emplace_back(value);
-            }
-        });
+        storage_.uninitialized_fill_n(capacity_check(count), value);
     }
 
+    // The range constructors only construct elements, so they support non-movable elements. Should a construction
+    // throw, the elements already constructed are destroyed by the append.
     template <std::input_iterator InputIt>
     constexpr inplace_vector(InputIt first, InputIt last)
     {
-        storage_.exception_guard([&] {
-            assign(std::move(first), std::move(last));
-        });
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+            storage_.uninitialized_copy_n(std::move(first), capacity_check(count));
+        } else {
+            append_unsized(std::move(first), std::move(last));
+        }
     }
 
     template <detail::container_compatible_range<T> R>
     constexpr inplace_vector(std::from_range_t, R&& rg)
-        : inplace_vector(std::ranges::begin(rg), std::ranges::end(rg))
     {
+        append_range(std::forward<R>(rg));
+    }
+
+    /// Construct a vector from a range, without invoking the overflow policy.
+    /// @param rg The range of elements.
+    /// @return The vector, or inplace_vector_errc::capacity_exceeded if the range has more than capacity() elements.
+    template <detail::container_compatible_range<T> R>
+    static constexpr expected<inplace_vector> try_from_range(R&& rg)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        inplace_vector v;
+        if (const auto result = v.try_assign_range(std::forward<R>(rg)); !result) {
+            return std::unexpected{result.error()};
+        }
+        return v;
     }
 
     constexpr inplace_vector(const inplace_vector& other) = default;
     constexpr inplace_vector(inplace_vector&& other)
         noexcept(N == 0 || std::is_nothrow_move_constructible_v<T>) = default;
 
+    /// Construct a copy of a vector of another capacity (or overflow policy). The copy is implicit, and cannot
+    /// overflow, when M <= N; otherwise it is explicit, and the overflow policy is invoked should the elements not
+    /// fit. Trivially copyable elements are copied with a single memcpy.
+    /// @param other The vector to copy.
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>) &&
+                 detail::inplace_vector::copy_constructible_element<T>
+    constexpr explicit(M > N) inplace_vector(const inplace_vector<T, M, OtherPolicy>& other)
+        noexcept(M <= N && std::is_nothrow_copy_constructible_v<T>)
+    {
+        if constexpr (M != 0) {
+            storage_.uninitialized_copy_n(other.data(), transfer_check<M>(other.size()));
+        }
+    }
+
+    /// Construct a vector from the elements of a vector of another capacity (or overflow policy), as the copy above,
+    /// leaving other empty. Trivially relocatable elements are relocated with a single memcpy.
+    /// @param other The vector from which to move.
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>) &&
+                 detail::inplace_vector::move_constructible_element<T>
+    constexpr explicit(M > N) inplace_vector(inplace_vector<T, M, OtherPolicy>&& other)
+        noexcept(M <= N && (is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>))
+    {
+        // Elements that don't fit (when the policy saturates) are dropped before the remainder is moved.
+        const auto count = transfer_check<M>(other.size());
+        other.storage_.destroy(count, other.size());
+        other.storage_.size(count);
+        storage_.splice_from(other.storage_, 0);
+    }
+
     constexpr inplace_vector(std::initializer_list<value_type> init)
         : inplace_vector(init.begin(), init.end())
     {
@@ -107,47 +192,131 @@ public:
     constexpr inplace_vector& operator=(inplace_vector&& other)
         noexcept(N == 0 || (std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>)) = default;
 
+    /// Assign a copy of a vector of another capacity (or overflow policy). The assignment cannot overflow when M <= N;
+    /// otherwise the overflow policy is invoked should the elements not fit (see try_assign).
+    /// @param other The vector to copy.
+    /// @return This vector.
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>) &&
+                 detail::inplace_vector::copy_assignable_element<T>
+    constexpr inplace_vector& operator=(const inplace_vector<T, M, OtherPolicy>& other)
+        noexcept(M <= N && std::is_nothrow_copy_assignable_v<T> && std::is_nothrow_copy_constructible_v<T>)
+    {
+        assign_n(other.data(), transfer_check<M>(other.size()));
+        return *this;
+    }
+
+    /// Assign the elements of a vector of another capacity (or overflow policy), moving from them and leaving other
+    /// empty, as the move construction above.
+    /// @param other The vector from which to move.
+    /// @return This vector.
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>) &&
+                 detail::inplace_vector::move_assignable_element<T>
+    constexpr inplace_vector& operator=(inplace_vector<T, M, OtherPolicy>&& other)
+        noexcept(M <= N && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_move_constructible_v<T>)
+    {
+        assign_n(move_source(other), transfer_check<M>(other.size()));
+        other.clear();
+        return *this;
+    }
+
     constexpr void assign(size_type count, const value_type& value)
+        requires detail::inplace_vector::movable_element<T>
     {
-        capacity_check(count);
-        const auto last = begin() + std::min(size(), count);
-        for (auto first = begin(); first != last; ++first) {
-            *first = value;
-        }
+        count = capacity_check(count);
+        std::fill_n(data(), std::min(size(), count), value);
         resize(count, value);
     }
 
     template <std::input_iterator InputIt>
     constexpr void assign(InputIt first, InputIt last)
+        requires detail::inplace_vector::movable_element<T>
     {
-        if constexpr (std::random_access_iterator<InputIt>) {
-            auto count = static_cast<size_type>(std::distance(first, last));
-            capacity_check(count);
-            const auto dest_end = begin() + std::min(size(), count);
-            for (auto dest = begin(); dest != dest_end; ++dest, ++first) {
-                *dest = *first;
-            }
-            for (; first != last; ++first) {
-                unchecked_emplace_back(*first);
-            }
-            resize(count);
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+            assign_n(std::move(first), count);
         } else {
-            clear();
-            for (; first != last; ++first) {
-                emplace_back(*first);
-            }
+            assign_unsized(std::move(first), std::move(last));
         }
     }
 
     constexpr void assign(std::initializer_list<value_type> init)
+        requires detail::inplace_vector::movable_element<T>
     {
         assign(init.begin(), init.end());
     }
 
+    /// The try_assign and try_assign_range operations replace the contents as assign and assign_range, but report
+    /// inplace_vector_errc::capacity_exceeded, rather than invoking the overflow policy, should the new contents not
+    /// fit. The vector is then unchanged, unless the size of the input could not be determined in advance, in which
+    /// case it is left empty.
+    constexpr expected<void> try_assign(size_type count, const value_type& value)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if (count > capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        assign(count, value);
+        return {};
+    }
+
+    template <std::input_iterator InputIt>
+    constexpr expected<void> try_assign(InputIt first, InputIt last)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+            return try_assign_n(std::move(first), count);
+        } else {
+            return try_assign_unsized(std::move(first), std::move(last));
+        }
+    }
+
+    constexpr expected<void> try_assign(std::initializer_list<value_type> init)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        return try_assign(init.begin(), init.end());
+    }
+
+    template <std::size_t M, typename OtherPolicy>
+    constexpr expected<void> try_assign(const inplace_vector<T, M, OtherPolicy>& other)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        return try_assign_n(other.data(), other.size());
+    }
+
+    template <std::size_t M, typename OtherPolicy>
+    constexpr expected<void> try_assign(inplace_vector<T, M, OtherPolicy>&& other)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        auto result = try_assign_n(move_source(other), other.size());
+        if (result) {
+            other.clear();
+        }
+        return result;
+    }
+
+    template <detail::container_compatible_range<T> R>
+    constexpr expected<void> try_assign_range(R&& rg)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            return try_assign_n(std::ranges::begin(rg), range_size(rg));
+        } else {
+            return try_assign_unsized(std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+
     template <detail::container_compatible_range<T> R>
     constexpr void assign_range(R&& rg)
+        requires detail::inplace_vector::movable_element<T>
     {
-        assign(std::ranges::begin(rg), std::ranges::end(rg));
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            assign_n(std::ranges::begin(rg), range_size(rg));
+        } else {
+            assign_unsized(std::ranges::begin(rg), std::ranges::end(rg));
+        }
     }
 
     constexpr reference at(size_type pos)
@@ -162,6 +331,25 @@ public:
         return data()[pos];
     }
 
+    /// Access the element at pos, with bounds checking.
+    /// @param pos The position of the element.
+    /// @return The element, or inplace_vector_errc::out_of_range if pos >= size().
+    constexpr expected<std::reference_wrapper<value_type>> try_at(size_type pos) noexcept
+    {
+        if (pos >= size()) {
+            return std::unexpected{inplace_vector_errc::out_of_range};
+        }
+        return std::ref(data()[pos]);
+    }
+
+    constexpr expected<std::reference_wrapper<const value_type>> try_at(size_type pos) const noexcept
+    {
+        if (pos >= size()) {
+            return std::unexpected{inplace_vector_errc::out_of_range};
+        }
+        return std::cref(data()[pos]);
+    }
+
     constexpr reference        operator[](size_type pos)       { return data()[pos]; }
     constexpr const_reference  operator[](size_type pos) const { return data()[pos]; }
 
@@ -187,26 +375,87 @@ public:
     static constexpr size_type max_size() noexcept       { return N; }
     static constexpr size_type capacity() noexcept       { return N; }
 
-    void resize(size_type count)
+    constexpr void resize(size_type count)
     {
+        count = capacity_check(count);
         if (size() > count) {
             storage_.destroy(count, size());
             storage_.size(count);
-        }
-        while (size() < count) {
-            unchecked_emplace_back();
+        } else {
+            storage_.uninitialized_value_construct_n(count - size());
         }
     }
 
-    void resize(size_type count, const value_type& value)
+    constexpr void resize(size_type count, const value_type& value)
     {
+        count = capacity_check(count);
         if (size() > count) {
             storage_.destroy(count, size());
             storage_.size(count);
+        } else {
+            storage_.uninitialized_fill_n(count - size(), value);
+        }
+    }
+
+    constexpr void resize(size_type count, default_init_t)
+    {
+        count = capacity_check(count);
+        if (size() > count) {
+            storage_.destroy(count, size());
+        } else {
+            storage_.default_construct(size(), count);
+        }
+        storage_.size(count);
+    }
+
+    /// The try_resize operations resize as resize, but report inplace_vector_errc::capacity_exceeded, leaving the
+    /// vector unchanged, rather than invoking the overflow policy, should count exceed the capacity.
+    constexpr expected<void> try_resize(size_type count)
+    {
+        if (count > capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
         }
-        while (size() < count) {
-            unchecked_emplace_back(value);
+        resize(count);
+        return {};
+    }
+
+    constexpr expected<void> try_resize(size_type count, const value_type& value)
+    {
+        if (count > capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        resize(count, value);
+        return {};
+    }
+
+    constexpr expected<void> try_resize(size_type count, default_init_t)
+    {
+        if (count > capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
         }
+        resize(count, default_init);
+        return {};
+    }
+
+    /// Resize to at most count elements, overwriting the contents by means of a user-provided operation.
+    /// The operation is invoked as op(data(), count), where the elements [size()..count) are default-initialized
+    /// (i.e. uninitialized), and returns the new size, no greater than count. A greater size invokes the overflow
+    /// policy, and is clamped to count should the policy saturate. As with the elements, the vector must not otherwise
+    /// be accessed from within the operation.
+    /// @param count The maximum size of the vector.
+    /// @param op The operation with which to overwrite the elements.
+    template <typename Operation>
+        requires std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>
+    constexpr void resize_and_overwrite(size_type count, Operation op)
+    {
+        count = capacity_check(count);
+        storage_.default_construct(std::min(size(), count), count);
+        auto new_size = static_cast<size_type>(std::move(op)(data(), count));
+        if (new_size > count) {
+            Policy::on_overflow();
+            new_size = count;
+        }
+        storage_.size(new_size);
     }
 
     static constexpr void reserve(size_type new_capacity)
@@ -217,8 +466,11 @@ public:
     static constexpr void shrink_to_fit() noexcept {}
 
     constexpr iterator insert(const_iterator pos, const value_type& value)
+        requires detail::inplace_vector::movable_element<T>
     {
-        capacity_check(size() + 1);
+        if (room_check(1) == 0) {
+            return remove_const(pos);
+        }
         attic_type attic{storage_, pos, size() + 1};
         unchecked_emplace_back(value);
         attic.retrieve();
@@ -226,8 +478,11 @@ public:
     }
 
     constexpr iterator insert(const_iterator pos, value_type&& value)
+        requires detail::inplace_vector::movable_element<T>
     {
-        capacity_check(size() + 1);
+        if (room_check(1) == 0) {
+            return remove_const(pos);
+        }
         attic_type attic{storage_, pos, size() + 1};
         unchecked_emplace_back(std::move(value));
         attic.retrieve();
@@ -235,66 +490,144 @@ public:
     }
 
     constexpr iterator insert(const_iterator pos, size_type count, const T& value)
+        requires detail::inplace_vector::movable_element<T>
     {
-        capacity_check(size() + count);
+        count = room_check(count);
         attic_type attic{storage_, pos, size() + count};
-        for (; count != 0; --count) {
-            unchecked_emplace_back(value);
-        }
+        storage_.uninitialized_fill_n(count, value);
         attic.retrieve();
         return remove_const(pos);
     }
 
     template <std::input_iterator InputIt>
     constexpr iterator insert(const_iterator pos, InputIt first, InputIt last)
+        requires detail::inplace_vector::movable_element<T>
     {
-        if constexpr (std::random_access_iterator<InputIt>) {
-            // We can determine the size of the input range.
-            auto count = static_cast<size_type>(std::distance(first, last));
-            capacity_check(size() + count);
-            attic_type attic{storage_, pos, size() + count};
-            for (; count != 0; --count) {
-                unchecked_emplace_back(*first++);
-            }
-            attic.retrieve();
-            return remove_const(pos);
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+            return insert_n(pos, std::move(first), count);
         } else {
-            // We can't determine the size of the input range, so move the attic all the way up.
-            attic_type attic{storage_, pos, capacity()};
-            while (first != last) {
-                attic.capacity_check(size());
-                unchecked_emplace_back(*first++);
-            }
-            attic.retrieve(); // Moves the attic elements back into place.
-            return remove_const(pos);
+            return insert_unsized(pos, std::move(first), std::move(last));
         }
     }
 
     constexpr iterator insert(const_iterator pos, std::initializer_list<T> init)
+        requires detail::inplace_vector::movable_element<T>
     {
         return insert(pos, init.begin(), init.end());
     }
 
     template <detail::container_compatible_range<T> R>
     constexpr iterator insert_range(const_iterator pos, R&& rg)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            return insert_n(pos, std::ranges::begin(rg), range_size(rg));
+        } else {
+            return insert_unsized(pos, std::ranges::begin(rg), std::ranges::end(rg));
+        }
+    }
+
+    /// The try_insert and try_insert_range operations insert as insert and insert_range, but report
+    /// inplace_vector_errc::capacity_exceeded, rather than invoking the overflow policy, should the new elements not
+    /// fit. The vector is then unchanged, although elements already consumed from an input range are lost.
+    constexpr expected<iterator> try_insert(const_iterator pos, const value_type& value)
+        requires detail::inplace_vector::movable_element<T>
     {
-        return insert(pos, std::ranges::begin(rg), std::ranges::end(rg));
+        return try_emplace(pos, value);
+    }
+
+    constexpr expected<iterator> try_insert(const_iterator pos, value_type&& value)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        return try_emplace(pos, std::move(value));
+    }
+
+    constexpr expected<iterator> try_insert(const_iterator pos, size_type count, const T& value)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if (count > capacity() - size()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        return insert(pos, count, value);
+    }
+
+    template <std::input_iterator InputIt>
+    constexpr expected<iterator> try_insert(const_iterator pos, InputIt first, InputIt last)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (std::sized_sentinel_for<InputIt, InputIt> || std::forward_iterator<InputIt>) {
+            const auto count = static_cast<size_type>(std::ranges::distance(first, last));
+            return try_insert_n(pos, std::move(first), count);
+        } else {
+            return try_insert_unsized(pos, std::move(first), std::move(last));
+        }
+    }
+
+    constexpr expected<iterator> try_insert(const_iterator pos, std::initializer_list<T> init)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        return try_insert(pos, init.begin(), init.end());
+    }
+
+    template <detail::container_compatible_range<T> R>
+    constexpr expected<iterator> try_insert_range(const_iterator pos, R&& rg)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            return try_insert_n(pos, std::ranges::begin(rg), range_size(rg));
+        } else {
+            return try_insert_unsized(pos, std::ranges::begin(rg), std::ranges::end(rg));
+        }
     }
 
     template <typename... Args>
     constexpr iterator emplace(const_iterator pos, Args&&... args)
+        requires detail::inplace_vector::movable_element<T>
     {
-        capacity_check(size() + 1);
+        if (room_check(1) == 0) {
+            return remove_const(pos);
+        }
         attic_type attic{storage_, pos, size() + 1};
         unchecked_emplace_back(std::forward<Args>(args)...);
         attic.retrieve();
         return remove_const(pos);
     }
 
+    /// Construct an element in place at pos, as emplace, but report inplace_vector_errc::capacity_exceeded, leaving
+    /// the vector unchanged, rather than invoking the overflow policy, should the vector be full.
+    /// @param pos The insertion position.
+    /// @param args The arguments with which to construct the element.
+    /// @return An iterator to the new element, or the error.
+    template <typename... Args>
+    constexpr expected<iterator> try_emplace(const_iterator pos, Args&&... args)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if (size() == capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        return emplace(pos, std::forward<Args>(args)...);
+    }
+
+    /// Open an insertion session at pos, through which any number of elements may be inserted there, each in O(1).
+    /// The elements following pos are moved aside once, and moved back when the session is committed or destroyed.
+    /// @param pos The insertion position.
+    /// @return The insertion session.
+    constexpr insertion_session open_insertion(const_iterator pos)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        return insertion_session{storage_, pos};
+    }
+
+    /// Should the vector be full and the overflow policy saturate, the element is dropped, and the reference returned
+    /// is unspecified and must not be used.
     template <typename... Args>
     constexpr reference emplace_back(Args&&... args)
+        requires (N != 0 || !overflow_saturates<Policy>)
     {
-        capacity_check(size() + 1);
+        if (room_check(1) == 0) {
+            return data()[N - 1]; // The policy saturated, dropping the element.
+        }
         return unchecked_emplace_back(std::forward<Args>(args)...);
     }
 
@@ -316,11 +649,13 @@ public:
     }
 
     constexpr reference push_back(const value_type& value)
+        requires (N != 0 || !overflow_saturates<Policy>)
     {
         return emplace_back(value);
     }
 
     constexpr reference push_back(value_type&& value)
+        requires (N != 0 || !overflow_saturates<Policy>)
     {
         return emplace_back(std::move(value));
     }
@@ -354,22 +689,28 @@ public:
     template <detail::container_compatible_range<T> R>
     constexpr void append_range(R&& rg)
     {
-        capacity_check(size() + std::ranges::size(rg));
-        for (auto&& value : rg) {
-            unchecked_emplace_back(std::forward<decltype(value)>(value));
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            storage_.uninitialized_copy_n(std::ranges::begin(rg), room_check(range_size(rg)));
+        } else {
+            append_unsized(std::ranges::begin(rg), std::ranges::end(rg));
         }
     }
 
     template <detail::container_compatible_range<T> R>
     constexpr std::ranges::borrowed_iterator_t<R> try_append_range(R&& rg)
     {
-        const auto available = capacity() - size();
-        auto count = std::min(std::ranges::size(rg), available);
-        auto pos = std::ranges::begin(rg);
-        for (; count != 0; ++pos, --count) {
-            unchecked_emplace_back(*pos);
+        if constexpr (std::ranges::sized_range<R> || std::ranges::forward_range<R>) {
+            const auto available = capacity() - size();
+            const auto count = std::min(range_size(rg), available);
+            return storage_.uninitialized_copy_n(std::ranges::begin(rg), count);
+        } else {
+            auto first = std::ranges::begin(rg);
+            const auto last = std::ranges::end(rg);
+            for (; size() != capacity() && first != last; ++first) {
+                unchecked_emplace_back(std::forward<std::ranges::range_reference_t<R>>(*first));
+            }
+            return first;
         }
-        return pos;
     }
 
     constexpr void clear() noexcept
@@ -378,102 +719,550 @@ public:
     }
 
     constexpr iterator erase(const_iterator pos)
+        requires detail::inplace_vector::movable_element<T>
     {
         return erase(pos, pos + 1);
     }
 
     constexpr iterator erase(const_iterator first, const_iterator last)
+        requires detail::inplace_vector::movable_element<T>
     {
-        auto dst = remove_const(first);
-        auto src = remove_const(last);
-        while (src != end()) {
-            *dst++ = std::move(*src++);
+        if constexpr (is_trivially_relocatable_v<T>) {
+            const auto first_index = static_cast<size_type>(first - begin());
+            const auto last_index  = static_cast<size_type>(last - begin());
+            storage_.destroy(first_index, last_index);
+            storage_.relocate(last_index, size(), first_index);
+            storage_.size(size() - (last_index - first_index));
+        } else {
+            auto dst = remove_const(first);
+            auto src = remove_const(last);
+            while (src != end()) {
+                *dst++ = std::move(*src++);
+            }
+            const auto new_size = dst - begin();
+            storage_.destroy(new_size, size());
+            storage_.size(new_size);
         }
-        const auto new_size = dst - begin();
-        storage_.destroy(new_size, size());
-        storage_.size(new_size);
         return remove_const(first);
     }
 
-    constexpr void swap(inplace_vector& other)
-        noexcept(N == 0 || (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>))
+    /// Erase the element at pos in O(1) by moving the last element into its place. The order of the remaining
+    /// elements is not preserved.
+    /// @param pos The element to erase.
+    /// @return An iterator to the element that replaced the erased element, or end().
+    constexpr iterator unordered_erase(const_iterator pos)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        unordered_erase_at(static_cast<size_type>(pos - begin()));
+        return remove_const(pos);
+    }
+
+    /// Erase every element satisfying a predicate, filling each gap with the last element. The order of the
+    /// remaining elements is not preserved.
+    /// @param predicate The predicate selecting the elements to erase.
+    /// @return The number of elements erased.
+    template <typename Predicate>
+    constexpr size_type unordered_erase_if(Predicate predicate)
+        requires detail::inplace_vector::movable_element<T>
+    {
+        const auto starting_size = size();
+        for (size_type i = 0; i != size();) {
+            if (std::invoke(predicate, std::as_const(data()[i]))) {
+                unordered_erase_at(i);
+            } else {
+                ++i;
+            }
+        }
+        return starting_size - size();
+    }
+
+    /// Erase the elements at a set of positions in a single compaction pass, preserving the order of the remaining
+    /// elements. The indices must be unique, ascending, and less than size(). Should moving an element throw, every
+    /// element remains valid, but which have been erased is unspecified.
+    /// @param indices The positions of the elements to erase.
+    /// @return The number of elements erased.
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, size_type> &&
+                 detail::inplace_vector::movable_element<T>
+    constexpr size_type erase_indices(R&& indices)
     {
-        auto swap_count = std::min(size(), other.size());
-        size_type i = 0;
-        for (; i < swap_count; ++i) {
-            std::swap((*this)[i], other[i]);
+        const auto starting_size = size();
+        size_type dest = 0; // The end of the retained elements.
+        size_type src  = 0; // The first element not yet examined.
+
+        if constexpr (is_trivially_relocatable_v<T>) {
+            const auto close_gap = [&] {
+                if (dest != src) {
+                    storage_.relocate(src, size(), dest);
+                }
+                storage_.size(dest + (size() - src));
+            };
+            JELL_INPLACE_VECTOR_TRY {
+                for (auto&& i : indices) {
+                    const auto index = static_cast<size_type>(i);
+                    if (dest != src) {
+                        storage_.relocate(src, index, dest);
+                    }
+                    dest += index - src;
+                    storage_.destroy_at(index);
+                    src = index + 1;
+                }
+            } JELL_INPLACE_VECTOR_CATCH_ALL {
+                close_gap();
+                JELL_INPLACE_VECTOR_RETHROW;
+            }
+            close_gap();
+        } else {
+            for (auto&& i : indices) {
+                const auto index = static_cast<size_type>(i);
+                if (dest != src) {
+                    std::move(data() + src, data() + index, data() + dest);
+                }
+                dest += index - src;
+                src = index + 1;
+            }
+            if (dest != src) {
+                std::move(data() + src, data() + size(), data() + dest);
+            }
+            dest += size() - src;
+            storage_.destroy(dest, size());
+            storage_.size(dest);
         }
-        if (i < other.size()) {
-            const auto first = other.begin() + i;
-            append_range(std::ranges::subrange(first, other.end()) | std::views::as_rvalue);
-            other.erase(first, other.end());
-        } else if (i < size()) {
-            const auto first = begin() + i;
-            other.append_range(std::ranges::subrange(first, end()) | std::views::as_rvalue);
-            erase(first, end());
+        return starting_size - size();
+    }
+
+    constexpr void swap(inplace_vector& other)
+        noexcept(N == 0 || is_trivially_relocatable_v<T> ||
+                 (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>))
+        requires detail::inplace_vector::movable_element<T>
+    {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            storage_.swap(other.storage_);
+        } else {
+            auto swap_count = std::min(size(), other.size());
+            size_type i = 0;
+            for (; i < swap_count; ++i) {
+                std::swap((*this)[i], other[i]);
+            }
+            if (i < other.size()) {
+                const auto first = other.begin() + i;
+                append_range(std::ranges::subrange(first, other.end()) | std::views::as_rvalue);
+                other.erase(first, other.end());
+            } else if (i < size()) {
+                const auto first = begin() + i;
+                other.append_range(std::ranges::subrange(first, end()) | std::views::as_rvalue);
+                erase(first, end());
+            }
         }
     }
 
     constexpr friend bool operator==(const inplace_vector& lhs, const inplace_vector& rhs)
     {
-        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        return lhs.size() == rhs.size() && detail::inplace_vector::equal(lhs.data(), rhs.data(), lhs.size());
     }
 
     constexpr friend auto operator<=>(const inplace_vector& lhs, const inplace_vector& rhs)
     {
-        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        return detail::inplace_vector::compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size());
+    }
+
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>)
+    constexpr friend bool operator==(const inplace_vector& lhs, const inplace_vector<T, M, OtherPolicy>& rhs)
+    {
+        return lhs.size() == rhs.size() && detail::inplace_vector::equal(lhs.data(), rhs.data(), lhs.size());
+    }
+
+    template <std::size_t M, typename OtherPolicy>
+        requires (M != N || !std::is_same_v<OtherPolicy, Policy>)
+    constexpr friend auto operator<=>(const inplace_vector& lhs, const inplace_vector<T, M, OtherPolicy>& rhs)
+    {
+        return detail::inplace_vector::compare_three_way(lhs.data(), lhs.size(), rhs.data(), rhs.size());
     }
 
 private:
+    template <typename U, std::size_t M, typename OtherPolicy>
+    friend class inplace_vector;
+
+    friend struct detail::inplace_vector::storage_access;
+
     constexpr void range_check(size_type pos) const
     {
         if (pos >= size())
         {
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+            detail::inplace_vector::report_error("pos >= size()");
+#else
             throw std::out_of_range{std::format("pos >= size() [{} >= {}]", pos, size())};
+#endif
         }
     }
 
-    static constexpr void capacity_check(size_type size)
+    /// Check that size elements fit in the vector, invoking the overflow policy if they do not.
+    /// @param size The required size.
+    /// @return The size that may be reached: size, or capacity() if the policy saturates.
+    static constexpr size_type capacity_check(size_type size)
     {
         if (size > capacity())
         {
-            throw std::bad_alloc{};
+            Policy::on_overflow();
+            return capacity();
+        }
+        return size;
+    }
+
+    /// Check that the elements of a vector of capacity M fit in the vector, which they always do when M <= N.
+    /// @param size The size of the other vector.
+    /// @return The size that may be reached (see capacity_check).
+    template <std::size_t M>
+    static constexpr size_type transfer_check(size_type size)
+    {
+        if constexpr (M <= N) {
+            return size;
+        } else {
+            return capacity_check(size);
         }
     }
 
+    /// An iterator that moves from the elements of another vector; trivially copyable elements are instead copied
+    /// through a pointer, so that they are copied in bulk.
+    template <std::size_t M, typename OtherPolicy>
+    static constexpr auto move_source(inplace_vector<T, M, OtherPolicy>& other) noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            return other.data();
+        } else {
+            return std::make_move_iterator(other.data());
+        }
+    }
+
+    /// Check that count more elements fit in the vector, invoking the overflow policy if they do not.
+    /// @param count The number of elements to add.
+    /// @return The number of elements that may be added: count, or fewer if the policy saturates.
+    constexpr size_type room_check(size_type count) const
+    {
+        const auto available = capacity() - size();
+        if (count > available)
+        {
+            Policy::on_overflow();
+            return available;
+        }
+        return count;
+    }
+
     constexpr iterator remove_const(const_iterator pos)
     {
         return begin() + (pos - begin());
     }
 
+    /// Erase the element at index by moving the last element into its place.
+    constexpr void unordered_erase_at(size_type index)
+    {
+        const auto last_index = size() - 1;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            storage_.destroy_at(index);
+            if (index != last_index) {
+                storage_.relocate(last_index, size(), index);
+            }
+        } else {
+            if (index != last_index) {
+                data()[index] = std::move(data()[last_index]);
+            }
+            storage_.destroy_at(last_index);
+        }
+        storage_.size(last_index);
+    }
+
+    /// The number of elements in a range that can be counted without consuming it.
+    template <std::ranges::range R>
+        requires std::ranges::sized_range<R> || std::ranges::forward_range<R>
+    static constexpr size_type range_size(R& rg)
+    {
+        if constexpr (std::ranges::sized_range<R>) {
+            return static_cast<size_type>(std::ranges::size(rg));
+        } else {
+            return static_cast<size_type>(std::ranges::distance(rg));
+        }
+    }
+
+    /// Replace the contents with count elements of an input sequence, assigning over the existing elements, then
+    /// constructing or destroying the remainder.
+    template <std::input_iterator InputIt>
+    constexpr void assign_n(InputIt first, size_type count)
+    {
+        count = capacity_check(count);
+        const auto assigned = static_cast<std::iter_difference_t<InputIt>>(std::min(size(), count));
+        first = std::ranges::copy_n(std::move(first), assigned, data()).in;
+        if (size() > count) {
+            storage_.destroy(count, size());
+            storage_.size(count);
+        } else {
+            storage_.uninitialized_copy_n(std::move(first), count - size());
+        }
+    }
+
+    /// Replace the contents with an input sequence of unknown length.
+    template <std::input_iterator InputIt, typename Sentinel>
+    constexpr void assign_unsized(InputIt first, Sentinel last)
+    {
+        clear();
+        for (; first != last; ++first) {
+            if (size() == capacity()) {
+                Policy::on_overflow();
+                break; // The policy saturated, dropping the remaining elements.
+            }
+            unchecked_emplace_back(*first);
+        }
+    }
+
+    /// Replace the contents with count elements of an input sequence, should they fit.
+    template <std::input_iterator InputIt>
+    constexpr expected<void> try_assign_n(InputIt first, size_type count)
+    {
+        if (count > capacity()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        assign_n(std::move(first), count);
+        return {};
+    }
+
+    /// Replace the contents with an input sequence of unknown length, clearing the vector should it not fit.
+    template <std::input_iterator InputIt, typename Sentinel>
+    constexpr expected<void> try_assign_unsized(InputIt first, Sentinel last)
+    {
+        clear();
+        for (; first != last; ++first) {
+            if (size() == capacity()) {
+                clear();
+                return std::unexpected{inplace_vector_errc::capacity_exceeded};
+            }
+            unchecked_emplace_back(*first);
+        }
+        return {};
+    }
+
+    /// Append an input sequence of unknown length, checking the capacity as each element arrives. Should an element
+    /// not fit, or fail to construct, the elements already appended are removed.
+    template <std::input_iterator InputIt, typename Sentinel>
+    constexpr void append_unsized(InputIt first, Sentinel last)
+    {
+        const auto initial_size = size();
+        JELL_INPLACE_VECTOR_TRY {
+            for (; first != last; ++first) {
+                if (size() == capacity()) {
+                    Policy::on_overflow();
+                    break; // The policy saturated, dropping the remaining elements.
+                }
+                unchecked_emplace_back(*first);
+            }
+        } JELL_INPLACE_VECTOR_CATCH_ALL {
+            storage_.destroy(initial_size, size());
+            storage_.size(initial_size);
+            JELL_INPLACE_VECTOR_RETHROW;
+        }
+    }
+
+    /// Insert count elements of an input sequence, moving each element into place once.
+    template <std::input_iterator InputIt>
+    constexpr iterator insert_n(const_iterator pos, InputIt first, size_type count)
+    {
+        count = room_check(count);
+        attic_type attic{storage_, pos, size() + count};
+        storage_.uninitialized_copy_n(std::move(first), count);
+        attic.retrieve();
+        return remove_const(pos);
+    }
+
+    /// Insert an input sequence of unknown length.
+    template <std::input_iterator InputIt, typename Sentinel>
+    constexpr iterator insert_unsized(const_iterator pos, InputIt first, Sentinel last)
+    {
+        // We can't determine the size of the input range, so move the attic all the way up.
+        attic_type attic{storage_, pos, capacity()};
+        for (; first != last; ++first) {
+            if (attic.contains(size())) {
+                Policy::on_overflow();
+                break; // The policy saturated, dropping the remaining elements.
+            }
+            unchecked_emplace_back(*first);
+        }
+        attic.retrieve(); // Moves the attic elements back into place.
+        return remove_const(pos);
+    }
+
+    /// Insert count elements of an input sequence, should they fit.
+    template <std::input_iterator InputIt>
+    constexpr expected<iterator> try_insert_n(const_iterator pos, InputIt first, size_type count)
+    {
+        if (count > capacity() - size()) {
+            return std::unexpected{inplace_vector_errc::capacity_exceeded};
+        }
+        return insert_n(pos, std::move(first), count);
+    }
+
+    /// Insert an input sequence of unknown length, removing the inserted elements should it not fit.
+    template <std::input_iterator InputIt, typename Sentinel>
+    constexpr expected<iterator> try_insert_unsized(const_iterator pos, InputIt first, Sentinel last)
+    {
+        const auto index = static_cast<size_type>(pos - begin());
+        attic_type attic{storage_, pos, capacity()};
+        for (; first != last; ++first) {
+            if (attic.contains(size())) {
+                storage_.destroy(index, size());
+                storage_.size(index);
+                attic.retrieve();
+                return std::unexpected{inplace_vector_errc::capacity_exceeded};
+            }
+            unchecked_emplace_back(*first);
+        }
+        attic.retrieve();
+        return remove_const(pos);
+    }
+
     [[no_unique_address]] storage_type storage_;
 };
 
+/// Concatenate two vectors into a vector of their combined capacity, so the concatenation cannot overflow.
+/// Trivially copyable elements are copied in bulk, and only the live elements are copied.
+/// @param lhs The leading elements.
+/// @param rhs The trailing elements.
+/// @return The concatenation, with the overflow policy of lhs.
+template <typename T, std::size_t N, typename Policy, std::size_t M, typename OtherPolicy>
+    requires detail::inplace_vector::copy_constructible_element<T>
+constexpr inplace_vector<T, N + M, Policy> concat(const inplace_vector<T, N, Policy>& lhs,
+                                                  const inplace_vector<T, M, OtherPolicy>& rhs)
+{
+    inplace_vector<T, N + M, Policy> result(lhs);
+    if constexpr (M != 0) {
+        result.append_range(rhs);
+    }
+    return result;
+}
+
+/// Concatenate two vectors, as above, moving from their elements. Trivially relocatable elements are relocated in
+/// bulk.
+template <typename T, std::size_t N, typename Policy, std::size_t M, typename OtherPolicy>
+    requires detail::inplace_vector::move_constructible_element<T>
+constexpr inplace_vector<T, N + M, Policy> concat(inplace_vector<T, N, Policy>&& lhs,
+                                                  inplace_vector<T, M, OtherPolicy>&& rhs)
+{
+    using access = detail::inplace_vector::storage_access;
+
+    inplace_vector<T, N + M, Policy> result(std::move(lhs));
+    access::get(result).splice_from(access::get(rhs), 0);
+    return result;
+}
+
+/// Split a vector in two at K, into vectors of capacity K and N - K holding the first min(K, v.size()) elements and
+/// the remainder. Trivially copyable elements are copied in bulk, and only the live elements are copied.
+/// @tparam K The split position, and the capacity of the first vector.
+/// @param v The vector to split.
+/// @return The two vectors.
+template <std::size_t K, typename T, std::size_t N, typename Policy>
+    requires (K <= N) && detail::inplace_vector::copy_constructible_element<T>
+constexpr std::pair<inplace_vector<T, K, Policy>, inplace_vector<T, N - K, Policy>>
+split_at(const inplace_vector<T, N, Policy>& v)
+{
+    const auto middle = v.begin() + static_cast<std::ptrdiff_t>(std::min(K, v.size()));
+    std::pair<inplace_vector<T, K, Policy>, inplace_vector<T, N - K, Policy>> result;
+    result.first.append_range(std::ranges::subrange(v.begin(), middle));
+    result.second.append_range(std::ranges::subrange(middle, v.end()));
+    return result;
+}
+
+/// Split a vector in two at K, as above, moving from its elements and leaving it empty. Trivially relocatable
+/// elements are relocated in bulk.
+template <std::size_t K, typename T, std::size_t N, typename Policy>
+    requires (K <= N) && detail::inplace_vector::move_constructible_element<T>
+constexpr std::pair<inplace_vector<T, K, Policy>, inplace_vector<T, N - K, Policy>>
+split_at(inplace_vector<T, N, Policy>&& v)
+{
+    using access = detail::inplace_vector::storage_access;
+
+    std::pair<inplace_vector<T, K, Policy>, inplace_vector<T, N - K, Policy>> result;
+    access::get(result.second).splice_from(access::get(v), std::min(K, v.size()));
+    access::get(result.first).splice_from(access::get(v), 0);
+    return result;
+}
+
+/// Split a vector in two at a position known only at run time, into two vectors of capacity N holding the first
+/// min(pos, v.size()) elements and the remainder.
+/// @param v The vector to split.
+/// @param pos The split position.
+/// @return The two vectors.
+template <typename T, std::size_t N, typename Policy>
+    requires detail::inplace_vector::copy_constructible_element<T>
+constexpr std::pair<inplace_vector<T, N, Policy>, inplace_vector<T, N, Policy>>
+split(const inplace_vector<T, N, Policy>& v, std::size_t pos)
+{
+    const auto middle = v.begin() + static_cast<std::ptrdiff_t>(std::min(pos, v.size()));
+    std::pair<inplace_vector<T, N, Policy>, inplace_vector<T, N, Policy>> result;
+    result.first.append_range(std::ranges::subrange(v.begin(), middle));
+    result.second.append_range(std::ranges::subrange(middle, v.end()));
+    return result;
+}
+
+/// Split a vector in two at a position known only at run time, as above, moving from its elements and leaving it
+/// empty. Trivially relocatable elements are relocated in bulk.
+template <typename T, std::size_t N, typename Policy>
+    requires detail::inplace_vector::move_constructible_element<T>
+constexpr std::pair<inplace_vector<T, N, Policy>, inplace_vector<T, N, Policy>>
+split(inplace_vector<T, N, Policy>&& v, std::size_t pos)
+{
+    using access = detail::inplace_vector::storage_access;
+
+    std::pair<inplace_vector<T, N, Policy>, inplace_vector<T, N, Policy>> result;
+    access::get(result.second).splice_from(access::get(v), std::min(pos, v.size()));
+    access::get(result.first).splice_from(access::get(v), 0);
+    return result;
+}
+
 } // namespace jell
 
 namespace std {
 
-template <typename T, std::size_t N>
-constexpr void swap(jell::inplace_vector<T, N>& lhs, jell::inplace_vector<T, N>& rhs)
-    noexcept(N == 0 || (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>))
+template <typename T, std::size_t N, typename Policy>
+constexpr void swap(jell::inplace_vector<T, N, Policy>& lhs, jell::inplace_vector<T, N, Policy>& rhs)
+    noexcept(N == 0 || jell::is_trivially_relocatable_v<T> ||
+             (std::is_nothrow_swappable_v<T> && std::is_nothrow_move_constructible_v<T>))
+    requires jell::detail::inplace_vector::movable_element<T>
 {
     lhs.swap(rhs);
 }
 
-template <typename T, std::size_t N, typename U = T>
-constexpr auto erase(jell::inplace_vector<T, N>& c, const U& value)
+template <typename T, std::size_t N, typename Policy, typename U = T>
+constexpr auto erase(jell::inplace_vector<T, N, Policy>& c, const U& value)
+    requires jell::detail::inplace_vector::movable_element<T>
 {
-    using vector = jell::inplace_vector<T, N>;
+    using vector = jell::inplace_vector<T, N, Policy>;
+    if constexpr (N != 0 && jell::detail::inplace_vector::is_compressible_v<T>) {
+        if !consteval {
+            auto predicate = [&value](const T& element) { return element == value; };
+            const auto new_size = jell::detail::inplace_vector::remove_if(c.data(), c.size(), predicate);
+            const auto erase_count = c.size() - new_size;
+            c.erase(c.begin() + new_size, c.end());
+            return erase_count;
+        }
+    }
     auto iter = std::remove(c.begin(), c.end(), value);
     auto erase_count = static_cast<typename vector::size_type>(std::distance(iter, c.end()));
     c.erase(iter, c.end());
     return erase_count;
 }
 
-template <typename T, std::size_t N, typename Predicate>
-constexpr auto erase_if(jell::inplace_vector<T, N>& c, Predicate predicate)
+template <typename T, std::size_t N, typename Policy, typename Predicate>
+constexpr auto erase_if(jell::inplace_vector<T, N, Policy>& c, Predicate predicate)
+    requires jell::detail::inplace_vector::movable_element<T>
 {
-    using vector = jell::inplace_vector<T, N>;
+    using vector = jell::inplace_vector<T, N, Policy>;
+    if constexpr (N != 0 && jell::detail::inplace_vector::is_compressible_v<T>) {
+        if !consteval {
+            const auto new_size = jell::detail::inplace_vector::remove_if(c.data(), c.size(), predicate);
+            const auto erase_count = c.size() - new_size;
+            c.erase(c.begin() + new_size, c.end());
+            return erase_count;
+        }
+    }
     auto iter = std::remove_if(c.begin(), c.end(), predicate);
     auto erase_count = static_cast<typename vector::size_type>(std::distance(iter, c.end()));
     c.erase(iter, c.end());
@@ -0,0 +1,63 @@
+# Compile SOURCE to assembly with COMPILER, FLAGS and OPTIMIZATION, and check the assembly against the FileCheck
+# patterns in SOURCE with the given CHECK_PREFIXES. Each line of a loop body, from a local label to the last
+# conditional branch back to it, is prefixed with "loop:" so that the patterns can tell a loop from straight-line code.
+#
+# cmake -DCOMPILER=<compiler> -DFLAGS=<flags> -DOPTIMIZATION=<-On> -DINCLUDE_DIR=<dir> -DSOURCE=<source>
+#       -DFILECHECK=<FileCheck> -DCHECK_PREFIXES=<prefix,...> -DOUTPUT=<assembly file> -P filecheck_codegen.cmake
+
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+
+execute_process(
+    COMMAND ${COMPILER} ${flags} -std=c++23 ${OPTIMIZATION} -S -o ${OUTPUT} -I${INCLUDE_DIR} ${SOURCE}
+    ERROR_VARIABLE errors
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Failed to compile ${SOURCE}:\n${errors}")
+endif()
+
+# Find the loops: a conditional branch to a label above it, with no return in between, closes the loop that the label
+# opens. (A branch back across a return is more likely a block laid out of line.) Semicolons are escaped so that the
+# assembly can be handled as a list of lines.
+file(READ ${OUTPUT} assembly)
+string(REPLACE ";" "<semicolon>" assembly "${assembly}")
+string(REPLACE "\n" ";" lines "${assembly}")
+set(index 0)
+set(return_index -1)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^(\\.L[A-Za-z0-9_]+):")
+        set(label_index_${CMAKE_MATCH_1} ${index})
+    elseif(line MATCHES "^[ \t]+ret")
+        set(return_index ${index})
+    elseif(line MATCHES "^[ \t]+j([a-z]+)[ \t]+(\\.L[A-Za-z0-9_]+)$")
+        set(target ${CMAKE_MATCH_2})
+        if(NOT CMAKE_MATCH_1 STREQUAL "mp" AND DEFINED label_index_${target} AND
+           label_index_${target} GREATER return_index)
+            foreach(loop_index RANGE ${label_index_${target}} ${index})
+                set(in_loop_${loop_index} ON)
+            endforeach()
+        endif()
+    endif()
+    math(EXPR index "${index} + 1")
+endforeach()
+
+set(index 0)
+set(annotated)
+foreach(line IN LISTS lines)
+    if(in_loop_${index})
+        set(line "loop:${line}")
+    endif()
+    string(APPEND annotated "${line}\n")
+    math(EXPR index "${index} + 1")
+endforeach()
+string(REPLACE "<semicolon>" ";" annotated "${annotated}")
+file(WRITE ${OUTPUT} "${annotated}")
+
+execute_process(
+    COMMAND ${FILECHECK} --check-prefixes=${CHECK_PREFIXES} --input-file=${OUTPUT} ${SOURCE}
+    ERROR_VARIABLE errors
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "The code generated for ${SOURCE} at ${OPTIMIZATION} (${OUTPUT}) does not match:\n${errors}")
+endif()
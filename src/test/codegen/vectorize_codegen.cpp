@@ -0,0 +1,148 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Kernels whose generated x86-64 assembly is checked with FileCheck by filecheck_codegen.cmake, at -O2 (the CHECK
+// prefix) and at -O3 (CHECK and O3). Bulk operations on trivially copyable elements must be lowered to library calls
+// or packed stores (a vector register stored to memory), and no loop may store the element count, which the vector of
+// 64 ints keeps in a byte at offset 256; operations that can't fail must not throw, and insertion must not need
+// exception landing pads. The lines of each loop body are prefixed with "loop:" by filecheck_codegen.cmake.
+
+#include "inplace_vector.hpp"
+
+using vector = jell::inplace_vector<int, 64>;
+
+extern "C" {
+
+// CHECK-LABEL: {{^}}assign_count:
+// CHECK-NOT: {{^loop:.*[[:space:],]256\(%r[a-z0-9]+\)$}}
+// O3: {{^loop:[[:space:]]+v?mov(dq[au]|[ua]p[sd])[[:space:]]+%[xyz]mm[0-9]+, .*\(%r}}
+// CHECK-NOT: {{^loop:.*[[:space:],]256\(%r[a-z0-9]+\)$}}
+void assign_count(vector& v, vector::size_type count, int value)
+{
+    v.assign(count, value);
+}
+
+// CHECK-LABEL: {{^}}assign_range:
+// CHECK: {{memcpy|memmove|v?mov(dq[au]|[ua]p[sd])[[:space:]]+%[xyz]mm[0-9]+, .*\(%r}}
+void assign_range(vector& v, const int* first, const int* last)
+{
+    v.assign(first, last);
+}
+
+// CHECK-LABEL: {{^}}resize:
+// CHECK: {{memset|v?mov(dq[au]|[ua]p[sd])[[:space:]]+%[xyz]mm[0-9]+, .*\(%r}}
+void resize(vector& v, vector::size_type count)
+{
+    v.resize(count);
+}
+
+// With a capacity of 64, the packed stores of the fill may be fully unrolled rather than looped.
+// CHECK-LABEL: {{^}}resize_value:
+// CHECK-NOT: {{^loop:.*[[:space:],]256\(%r[a-z0-9]+\)$}}
+// O3: {{v?mov(dq[au]|[ua]p[sd])[[:space:]]+%[xyz]mm[0-9]+, .*\(%r}}
+// CHECK-NOT: {{^loop:.*[[:space:],]256\(%r[a-z0-9]+\)$}}
+void resize_value(vector& v, vector::size_type count, int value)
+{
+    v.resize(count, value);
+}
+
+// CHECK-LABEL: {{^}}unchecked_push_back:
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+void unchecked_push_back(vector& v, int value)
+{
+    v.unchecked_push_back(value);
+}
+
+// CHECK-LABEL: {{^}}erase:
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+// CHECK: memmove
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+void erase(vector& v, vector::const_iterator pos)
+{
+    v.erase(pos);
+}
+
+// CHECK-LABEL: {{^}}erase_range:
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+// CHECK: memmove
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+void erase_range(vector& v, vector::const_iterator first, vector::const_iterator last)
+{
+    v.erase(first, last);
+}
+
+// CHECK-LABEL: {{^}}equal:
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+// CHECK: {{memcmp|bcmp|v?pcmpeq[bwdq]}}
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+bool equal(const vector& lhs, const vector& rhs)
+{
+    return lhs == rhs;
+}
+
+// CHECK-LABEL: {{^}}copy:
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+// CHECK: {{rep movs|memcpy|memmove|v?mov(dq[au]|[ua]p[sd])[[:space:]]+%[xyz]mm[0-9]+, .*\(%r}}
+// CHECK-NOT: {{__cxa_throw|on_overflow|report_error}}
+void copy(vector& dest, const vector& source)
+{
+    dest = source;
+}
+
+// Insertion may throw on overflow, but moves the elements with memmove, and has nothing to clean up should it throw.
+// CHECK-LABEL: {{^}}insert_value:
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+// CHECK: memmove
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+void insert_value(vector& v, vector::const_iterator pos, int value)
+{
+    v.insert(pos, value);
+}
+
+// CHECK-LABEL: {{^}}insert_count:
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+// CHECK: memmove
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+void insert_count(vector& v, vector::const_iterator pos, vector::size_type count, int value)
+{
+    v.insert(pos, count, value);
+}
+
+// CHECK-LABEL: {{^}}insert_range:
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+// CHECK: memmove
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+void insert_range(vector& v, vector::const_iterator pos, const vector& other)
+{
+    v.insert_range(pos, other);
+}
+
+// CHECK-LABEL: {{^}}emplace:
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+// CHECK: memmove
+// CHECK-NOT: {{_Unwind_Resume|\.gcc_except_table|\.cfi_lsda}}
+void emplace(vector& v, vector::const_iterator pos, int value)
+{
+    v.emplace(pos, value);
+}
+
+} // extern "C"
@@ -0,0 +1,717 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// A constexpr mirror of the typed tests in inplace_vector_test.cpp. Each test is evaluated both during constant
+// evaluation (by static_assert) and at run time.
+
+#include "inplace_vector.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+
+/// Evaluate a test lambda, returning bool, both during constant evaluation and at run time.
+#define CONSTEXPR_TEST(...)                 \
+    do {                                    \
+        constexpr auto test = __VA_ARGS__;  \
+        static_assert(test());              \
+        EXPECT_TRUE(test());                \
+    } while (false)
+
+/// Constant evaluation of non-trivial elements starts the lifetime of array elements within an inactive union
+/// member, which clang supports from C++26 (P3074, trivial unions).
+#if defined(__cpp_trivial_union) || !defined(__clang__)
+#define CONSTEXPR_NON_TRIVIAL_ELEMENTS 1
+#endif
+
+namespace {
+
+template <typename T>
+class InplaceVectorConstexprTest : public testing::Test
+{
+};
+
+template <typename Vector>
+constexpr Vector make_vector(std::size_t count = Vector::capacity())
+{
+    Vector v;
+    for (std::size_t i = 0; i != count; ++i) {
+        v.unchecked_emplace_back(100 + i);
+    }
+    return v;
+}
+
+class ConstexprNonTrivial
+{
+public:
+    constexpr ConstexprNonTrivial(std::size_t value = 0) : value_{value} {}
+
+    constexpr ConstexprNonTrivial(const ConstexprNonTrivial& other) { value_ = other.value_; }
+    constexpr ConstexprNonTrivial(ConstexprNonTrivial&& other) { value_ = other.value_; }
+
+    constexpr ConstexprNonTrivial& operator=(const ConstexprNonTrivial& other) { value_ = other.value_; return *this; }
+    constexpr ConstexprNonTrivial& operator=(ConstexprNonTrivial&& other) { value_ = other.value_; return *this; }
+
+    constexpr ~ConstexprNonTrivial() { value_ = 0; }
+
+    constexpr friend bool operator==(const ConstexprNonTrivial&, const ConstexprNonTrivial&) = default;
+    constexpr friend auto operator<=>(const ConstexprNonTrivial&, const ConstexprNonTrivial&) = default;
+
+private:
+    std::size_t value_;
+};
+
+/// A single-pass view of a random-access range.
+template <typename Iter>
+class ConstexprInputIterator
+{
+public:
+    using difference_type   = std::iter_difference_t<Iter>;
+    using value_type        = std::iter_value_t<Iter>;
+    using reference         = std::iter_reference_t<Iter>;
+    using iterator_category = std::input_iterator_tag;
+
+    constexpr ConstexprInputIterator() = default;
+    constexpr explicit ConstexprInputIterator(Iter iter) : iter_{iter} {}
+
+    constexpr reference operator*() const { return *iter_; }
+
+    constexpr ConstexprInputIterator& operator++() { ++iter_; return *this; }
+    constexpr void operator++(int) { ++iter_; }
+
+    friend constexpr bool operator==(const ConstexprInputIterator&, const ConstexprInputIterator&) = default;
+
+private:
+    Iter iter_{};
+};
+
+using constexpr_vector_types = testing::Types<
+    jell::inplace_vector<int, 0>,
+    jell::inplace_vector<int, 23>
+#if defined(CONSTEXPR_NON_TRIVIAL_ELEMENTS)
+    , jell::inplace_vector<ConstexprNonTrivial, 29>
+#endif
+>;
+TYPED_TEST_SUITE(InplaceVectorConstexprTest, constexpr_vector_types);
+
+} // namespace
+
+TYPED_TEST(InplaceVectorConstexprTest, is_default_constructible)
+{
+    CONSTEXPR_TEST([] {
+        TypeParam v;
+        return v.size() == 0;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_size_constructible)
+{
+    CONSTEXPR_TEST([] {
+        constexpr auto count = TypeParam::capacity() / 2;
+        TypeParam v(count);
+        return v.size() == count;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_size_value_constructible)
+{
+    CONSTEXPR_TEST([] {
+        constexpr auto count = TypeParam::capacity() / 2;
+        const auto value = typename TypeParam::value_type(100);
+        TypeParam v(count, value);
+        return v.size() == count && std::ranges::count(v, value) == static_cast<std::ptrdiff_t>(count);
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_iterator_constructible)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const TypeParam v(full.begin(), full.end());
+        return v == full;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_range_constructible)
+{
+    CONSTEXPR_TEST([] {
+        const TypeParam v(std::from_range, make_vector<TypeParam>() | std::views::as_rvalue);
+        return v == make_vector<TypeParam>();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_copy_constructible)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const TypeParam v(full);
+        return v == full;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_move_constructible)
+{
+    CONSTEXPR_TEST([] {
+        auto full = make_vector<TypeParam>();
+        const TypeParam v(std::move(full));
+        return v == make_vector<TypeParam>();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_initializer_list_constructible)
+{
+    CONSTEXPR_TEST([] {
+        using value_type = typename TypeParam::value_type;
+        if constexpr (TypeParam::capacity() >= 3) {
+            const TypeParam v{value_type(100), value_type(200), value_type(300)};
+            return v.size() == 3 && v[2] == value_type(300);
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_assignable)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+        TypeParam empty;
+        empty = full;
+        TypeParam smaller(half);
+        smaller = full;
+        TypeParam larger(full);
+        larger = half;
+        return empty == full && smaller == full && larger == half;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, is_move_assignable)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+        TypeParam empty;
+        empty = make_vector<TypeParam>();
+        TypeParam smaller(half);
+        smaller = make_vector<TypeParam>();
+        TypeParam larger(full);
+        larger = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        return empty == full && smaller == full && larger == half;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_assign_count_values)
+{
+    CONSTEXPR_TEST([] {
+        const auto value = typename TypeParam::value_type(123);
+        const auto count = TypeParam::capacity();
+
+        auto v = make_vector<TypeParam>(count / 2);
+        v.assign(count, value);
+        return v.size() == count && std::ranges::count(v, value) == count;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_assign_iterator)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        const auto full = make_vector<TypeParam>();
+        v.assign(full.begin(), full.end());
+        return v == full;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_assign_iterator_without_random_access)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        const auto full = make_vector<TypeParam>();
+        v.assign(ConstexprInputIterator{full.begin()}, ConstexprInputIterator{full.end()});
+        return v == full;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_assign_initializer_list)
+{
+    CONSTEXPR_TEST([] {
+        using value_type = typename TypeParam::value_type;
+        if constexpr (TypeParam::capacity() >= 3) {
+            auto v = make_vector<TypeParam>();
+            v.assign({value_type(100), value_type(200), value_type(300)});
+            return v.size() == 3;
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_assign_range)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>();
+        v.assign_range(make_vector<TypeParam>(TypeParam::capacity() / 2) | std::views::as_rvalue);
+        return v == make_vector<TypeParam>(TypeParam::capacity() / 2);
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, element_access)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() > 2) {
+            auto v = make_vector<TypeParam>();
+            const auto cv = make_vector<TypeParam>();
+            return v.at(1) == *(v.begin() + 1) && cv.at(1) == *(cv.begin() + 1) &&
+                   v[2] == *(v.begin() + 2) && cv[2] == *(cv.begin() + 2) &&
+                   v.front() == *v.begin() && cv.front() == *cv.begin() &&
+                   v.back() == *(v.end() - 1) && cv.back() == *(cv.end() - 1) &&
+                   v.data() == std::to_address(v.begin());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, size_and_capacity)
+{
+    CONSTEXPR_TEST([] {
+        const TypeParam empty;
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        return empty.empty() && empty.size() == 0 &&
+               half.size() == TypeParam::capacity() / 2 &&
+               half.max_size() == TypeParam::capacity() &&
+               half.capacity() == TypeParam::capacity();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_resize)
+{
+    CONSTEXPR_TEST([] {
+        constexpr auto count = TypeParam::capacity();
+        const auto value = typename TypeParam::value_type(100);
+
+        TypeParam v(count);
+        v.resize(count / 2);
+        const auto smaller = v.size() == count / 2;
+        v.resize(count, value);
+        return smaller && v.size() == count &&
+               std::ranges::count(v.begin() + count / 2, v.end(), value) == count - count / 2;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_resize_default_init)
+{
+    CONSTEXPR_TEST([] {
+        constexpr auto count = TypeParam::capacity();
+
+        auto v = make_vector<TypeParam>(count / 2);
+        v.resize(count, jell::default_init);
+        const auto larger = v.size() == count;
+        v.resize(count / 2, jell::default_init);
+        return larger && v == make_vector<TypeParam>(count / 2);
+    });
+}
+
+TEST(InplaceVectorConstexprTest, can_resize_and_overwrite)
+{
+    CONSTEXPR_TEST([] {
+        jell::inplace_vector<int, 8> v{1, 2};
+        v.resize_and_overwrite(v.capacity(), [](int* p, std::size_t) {
+            p[2] = p[0] + p[1];
+            return 3;
+        });
+        return v == jell::inplace_vector<int, 8>{1, 2, 3};
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, reserve_and_shrink_to_fit)
+{
+    CONSTEXPR_TEST([] {
+        TypeParam v;
+        v.reserve(TypeParam::capacity());
+        v.shrink_to_fit();
+        return v.capacity() == TypeParam::capacity();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_insert)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+            const auto value = typename TypeParam::value_type(200);
+
+            TypeParam front(half);
+            const auto front_pos = front.insert(front.begin(), value);
+            TypeParam back(half);
+            const auto back_pos = back.insert(back.end(), value);
+            return front_pos == front.begin() && front.front() == value &&
+                   std::ranges::equal(front.begin() + 1, front.end(), half.begin(), half.end()) &&
+                   back_pos == back.end() - 1 && back.back() == value &&
+                   std::ranges::equal(back.begin(), back.end() - 1, half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_move_insert)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+            TypeParam v(half);
+            auto value = typename TypeParam::value_type(200);
+            const auto pos = v.insert(v.begin() + 1, std::move(value));
+            return pos == v.begin() + 1 && *pos == typename TypeParam::value_type(200) &&
+                   v.size() == half.size() + 1;
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_count_insert)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+            const auto count = half.size();
+            const auto value = typename TypeParam::value_type(200);
+
+            TypeParam v(half);
+            const auto pos = v.insert(v.begin(), count, value);
+            return pos == v.begin() && v.size() == 2 * count &&
+                   std::ranges::count(v.begin(), v.begin() + count, value) == static_cast<std::ptrdiff_t>(count) &&
+                   std::ranges::equal(v.begin() + count, v.end(), half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_iterator_insert)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+            TypeParam v(half);
+            const auto pos = v.insert(v.begin(), half.begin(), half.end());
+            return pos == v.begin() && v.size() == 2 * half.size() &&
+                   std::ranges::equal(v.begin(), v.begin() + half.size(), half.begin(), half.end()) &&
+                   std::ranges::equal(v.begin() + half.size(), v.end(), half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_iterator_insert_without_random_access)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+            TypeParam v(half);
+            const auto pos = v.insert(v.begin(),
+                                      ConstexprInputIterator{half.begin()},
+                                      ConstexprInputIterator{half.end()});
+            return pos == v.begin() && v.size() == 2 * half.size() &&
+                   std::ranges::equal(v.begin(), v.begin() + half.size(), half.begin(), half.end()) &&
+                   std::ranges::equal(v.begin() + half.size(), v.end(), half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_insert_initializer_list)
+{
+    CONSTEXPR_TEST([] {
+        using value_type = typename TypeParam::value_type;
+        if constexpr (TypeParam::capacity() >= 3) {
+            TypeParam v(1, value_type(300));
+            v.insert(v.begin(), {value_type(100), value_type(200)});
+            return v.size() == 3 && v[0] == value_type(100) && v[1] == value_type(200) && v[2] == value_type(300);
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_insert_range)
+{
+    CONSTEXPR_TEST([] {
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+        TypeParam v(half);
+        const auto pos = v.insert_range(v.begin(), make_vector<TypeParam>(TypeParam::capacity() / 2));
+        return pos == v.begin() &&
+               std::ranges::equal(v.begin(), v.begin() + half.size(), half.begin(), half.end()) &&
+               std::ranges::equal(v.begin() + half.size(), v.end(), half.begin(), half.end());
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_emplace)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+            TypeParam v(half);
+            const auto pos = v.emplace(v.begin(), 200uz);
+            return pos == v.begin() && v.front() == typename TypeParam::value_type(200) &&
+                   std::ranges::equal(v.begin() + 1, v.end(), half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_insert_through_session)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+            TypeParam v(half);
+            {
+                auto session = v.open_insertion(v.begin());
+                session.emplace(200uz);
+                session.emplace(201uz);
+            }
+            return v.size() == half.size() + 2 && v[0] == typename TypeParam::value_type(200) &&
+                   v[1] == typename TypeParam::value_type(201) &&
+                   std::ranges::equal(v.begin() + 2, v.end(), half.begin(), half.end());
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_emplace_and_push_back)
+{
+    CONSTEXPR_TEST([] {
+        using value_type = typename TypeParam::value_type;
+        if constexpr (TypeParam::capacity() >= 4) {
+            TypeParam v;
+            const auto value = value_type(400);
+            v.emplace_back(100uz);
+            v.push_back(value_type(200));
+            const auto emplaced = v.try_emplace_back(300uz);
+            const auto pushed = v.try_push_back(value);
+            return v.size() == 4 && v[0] == value_type(100) && v[1] == value_type(200) &&
+                   emplaced == &v[2] && *emplaced == value_type(300) && pushed == &v[3] && *pushed == value;
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, handles_try_emplace_back_overflow)
+{
+    CONSTEXPR_TEST([] {
+        auto full = make_vector<TypeParam>();
+        return full.try_emplace_back(999uz) == nullptr &&
+               full.try_push_back(typename TypeParam::value_type(999)) == nullptr;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_pop_back)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            auto v = make_vector<TypeParam>();
+            v.pop_back();
+            return v.size() == TypeParam::capacity() - 1;
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_append_range)
+{
+    CONSTEXPR_TEST([] {
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+        TypeParam v(half);
+        v.append_range(make_vector<TypeParam>(TypeParam::capacity() / 2) | std::views::as_rvalue);
+        return std::ranges::equal(v.begin(), v.begin() + half.size(), half.begin(), half.end()) &&
+               std::ranges::equal(v.begin() + half.size(), v.end(), half.begin(), half.end());
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_try_append_range)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        const auto full = make_vector<TypeParam>();
+        const auto pos = v.try_append_range(full);
+        return v.size() == v.capacity() && pos == full.begin() + (v.capacity() - v.capacity() / 2);
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_try_insert_and_resize)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        auto full = make_vector<TypeParam>();
+        return full.try_emplace(full.begin(), 999uz).error() == jell::inplace_vector_errc::capacity_exceeded &&
+               !full.try_resize(TypeParam::capacity() + 1).has_value() &&
+               v.try_resize(TypeParam::capacity()).has_value() && v.size() == TypeParam::capacity() &&
+               !v.try_at(TypeParam::capacity()).has_value();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_convert_between_capacities)
+{
+    CONSTEXPR_TEST([] {
+        using larger = jell::inplace_vector<typename TypeParam::value_type, TypeParam::capacity() + 1>;
+        auto v = make_vector<TypeParam>();
+        larger copied = v;
+        const larger moved = std::move(v);
+        const TypeParam narrowed(moved);
+        return copied == moved && narrowed == moved && (copied <=> narrowed) == 0;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_concat_and_split)
+{
+    CONSTEXPR_TEST([] {
+        constexpr auto half = TypeParam::capacity() / 2;
+        const auto [head, tail] = jell::split_at<half>(make_vector<TypeParam>());
+        auto [moved_head, moved_tail] = jell::split_at<half>(make_vector<TypeParam>());
+        const auto joined = jell::concat(head, tail);
+        const auto moved_joined = jell::concat(std::move(moved_head), std::move(moved_tail));
+        const auto [first, second] = jell::split(joined, half);
+        return head.size() == half && joined == make_vector<TypeParam>() && moved_joined == joined &&
+               first == head && second == tail;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_clear)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>();
+        v.clear();
+        return v.empty();
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_erase)
+{
+    CONSTEXPR_TEST([] {
+        if constexpr (TypeParam::capacity() != 0) {
+            const auto full = make_vector<TypeParam>();
+            const auto count = full.size();
+
+            auto single = make_vector<TypeParam>();
+            const auto single_pos = single.erase(single.begin());
+            auto first = make_vector<TypeParam>();
+            const auto first_pos = first.erase(first.begin(), first.begin() + count / 2);
+            auto last = make_vector<TypeParam>();
+            const auto last_pos = last.erase(last.begin() + count / 2, last.end());
+            return single_pos == single.begin() &&
+                   std::ranges::equal(single.begin(), single.end(), full.begin() + 1, full.end()) &&
+                   first_pos == first.begin() &&
+                   std::ranges::equal(first.begin(), first.end(), full.begin() + count / 2, full.end()) &&
+                   last_pos == last.end() &&
+                   std::ranges::equal(last.begin(), last.end(), full.begin(), full.begin() + count / 2);
+        }
+        return true;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_swap)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+
+        auto same_lhs = full;
+        auto same_rhs = full;
+        std::swap(same_lhs, same_rhs);
+        auto smaller = half;
+        auto greater = full;
+        std::swap(smaller, greater);
+        return same_lhs == full && same_rhs == full && smaller == full && greater == half;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_erase_value_and_predicate)
+{
+    CONSTEXPR_TEST([] {
+        using value_type = typename TypeParam::value_type;
+
+        TypeParam values;
+        TypeParam predicate;
+        for (std::size_t i = 0; i != TypeParam::capacity(); ++i) {
+            values.emplace_back(100 + (i & 1));
+            predicate.emplace_back(100 + (i & 1));
+        }
+        const auto erased = std::erase(values, value_type(100));
+        std::erase_if(predicate, [](const value_type& value) { return value == value_type(101); });
+        return erased == TypeParam::capacity() - TypeParam::capacity() / 2 &&
+               std::ranges::count(values, value_type(101)) == std::ranges::ssize(values) &&
+               std::ranges::count(predicate, value_type(100)) == std::ranges::ssize(predicate);
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_compare)
+{
+    CONSTEXPR_TEST([] {
+        const auto full = make_vector<TypeParam>();
+        const auto half = make_vector<TypeParam>(TypeParam::capacity() / 2);
+        return full == make_vector<TypeParam>() && (half <=> full) <= 0 && (full <=> half) >= 0;
+    });
+}
+
+TYPED_TEST(InplaceVectorConstexprTest, can_use_iterators)
+{
+    CONSTEXPR_TEST([] {
+        auto v = make_vector<TypeParam>();
+        typename TypeParam::const_iterator ci;
+        ci = v.cbegin();
+        return v.begin() == v.cbegin() && v.end() == v.cend() && ci == v.begin() &&
+               v.end() - v.begin() == static_cast<std::ptrdiff_t>(v.size());
+    });
+}
+
+namespace {
+
+/// A lookup table built in a consteval function.
+consteval auto make_squares()
+{
+    jell::inplace_vector<int, 16> squares;
+    for (int i = 0; i != 10; ++i) {
+        squares.push_back(i * i);
+    }
+    std::erase_if(squares, [](int square) { return square % 2 != 0; });
+    squares.insert(squares.begin(), -1);
+    return squares;
+}
+
+constexpr auto squares = make_squares();
+static_assert(squares.size() == 6);
+static_assert(squares == jell::inplace_vector<int, 16>{-1, 0, 4, 16, 36, 64});
+
+} // namespace
+
+TEST(InplaceVectorConstexprTest, can_build_tables_in_consteval_functions)
+{
+    EXPECT_THAT(squares, testing::ElementsAre(-1, 0, 4, 16, 36, 64));
+}
@@ -25,12 +25,41 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
 static_assert(std::is_trivially_default_constructible_v<jell::inplace_vector<int, 0>>);
 static_assert(jell::inplace_vector<int, 0>{}.size() == 0);
 static_assert(jell::inplace_vector<int, 0>::max_size() == 0);
 static_assert(jell::inplace_vector<int, 0>::capacity() == 0);
 static_assert(jell::inplace_vector<int, 0>{}.data() == nullptr);
 
+static_assert(std::is_trivially_copyable_v<jell::inplace_vector<int, 4>>);
+
+// The element count is stored in the smallest unsigned type that can hold the capacity.
+static_assert(std::is_same_v<jell::inplace_vector<std::uint8_t, 15>::size_type, std::size_t>);
+static_assert(sizeof(jell::inplace_vector<std::uint8_t, 15>) == 16);
+static_assert(sizeof(jell::inplace_vector<std::uint8_t, 255>) == 256);
+static_assert(sizeof(jell::inplace_vector<std::uint8_t, 256>) == 258);
+static_assert(sizeof(jell::inplace_vector<std::uint16_t, 4>) == 10);
+static_assert(sizeof(jell::inplace_vector<int, 4>) == 20);
+static_assert(sizeof(jell::inplace_vector<int, 65536>) == 65536 * sizeof(int) + 4);
+static_assert(sizeof(jell::inplace_vector<char, 70000>) == 70004);
+static_assert(sizeof(jell::inplace_vector<std::uint64_t, 4>) == 40);
+
 static_assert(std::random_access_iterator<jell::inplace_vector<int, 1>::iterator>);
 static_assert(std::contiguous_iterator<jell::inplace_vector<int, 1>::iterator>);
 
@@ -49,6 +78,16 @@ const auto ZeroVector_expected_size = sizeof(ZeroVector::non_empty);
 
 static_assert(sizeof(ZeroVector) == ZeroVector_expected_size);
 
+// Without exceptions, errors are reported to the error handler, which aborts; and EXPECT_NO_THROW (which always
+// expands to a try block) simply runs the statement.
+#if defined(__cpp_exceptions)
+#define EXPECT_THROW_OR_DEATH(statement, exception) EXPECT_THROW(statement, exception)
+#else
+#define EXPECT_THROW_OR_DEATH(statement, exception) EXPECT_DEATH(statement, "")
+#undef EXPECT_NO_THROW
+#define EXPECT_NO_THROW(statement) statement
+#endif // __cpp_exceptions
+
 namespace {
 
 template <typename T>
@@ -102,6 +141,7 @@ private:
     std::size_t value_{0};
 };
 
+#if defined(__cpp_exceptions)
 class ThrowOnCopyOrMoveCounter
 {
 public:
@@ -144,6 +184,59 @@ public:
 private:
     std::size_t counter_;
 };
+#endif // __cpp_exceptions
+
+/// A trivially copyable type that opts in to size-proportional copying (see jell::enable_sized_copy).
+struct SizedCopy
+{
+    std::size_t value;
+
+    constexpr friend bool operator==(const SizedCopy&, const SizedCopy&) = default;
+};
+
+/// A type that owns heap memory, so is not trivially copyable, but is declared trivially relocatable
+/// (see jell::is_trivially_relocatable). Like NonTrivial, a moved-from value retains its value.
+class Relocatable
+{
+public:
+    Relocatable(std::size_t value = 0) : value_{std::make_unique<std::size_t>(value)} {}
+
+    Relocatable(const Relocatable& other) : value_{std::make_unique<std::size_t>(*other.value_)} {}
+    Relocatable(Relocatable&& other) : value_{std::make_unique<std::size_t>(*other.value_)} {}
+
+    Relocatable& operator=(const Relocatable& other) { *value_ = *other.value_; return *this; }
+    Relocatable& operator=(Relocatable&& other) { *value_ = *other.value_; return *this; }
+
+    ~Relocatable() = default;
+
+    friend bool operator==(const Relocatable& lhs, const Relocatable& rhs) { return *lhs.value_ == *rhs.value_; }
+
+private:
+    std::unique_ptr<std::size_t> value_;
+};
+
+} // namespace
+
+namespace jell {
+
+template <std::size_t N>
+constexpr bool enable_sized_copy<SizedCopy, N> = true;
+
+template <>
+struct is_trivially_relocatable<Relocatable> : std::true_type {};
+
+} // namespace jell
+
+static_assert(jell::is_trivially_relocatable_v<int>);
+static_assert(!jell::is_trivially_relocatable_v<std::string>);
+static_assert(noexcept(std::declval<jell::inplace_vector<Relocatable, 4>&>().swap(
+    std::declval<jell::inplace_vector<Relocatable, 4>&>())));
+
+static_assert(!std::is_trivially_copyable_v<jell::inplace_vector<SizedCopy, 4>>);
+static_assert(std::is_nothrow_copy_constructible_v<jell::inplace_vector<SizedCopy, 4>>);
+static_assert(std::is_nothrow_move_assignable_v<jell::inplace_vector<SizedCopy, 4>>);
+
+namespace {
 
 template <typename Iter>
 class MoveInputIterator
@@ -160,7 +253,7 @@ public:
           reference operator*()       { return *iter_; }
     const reference operator*() const { return *iter_; }
 
-    MoveInputIterator& operator++() { ++iter_; }
+    MoveInputIterator& operator++() { ++iter_; return *this; }
 
     MoveInputIterator operator++(int)
     {
@@ -178,8 +271,11 @@ private:
 using vector_types = testing::Types<
     jell::inplace_vector<std::size_t, 0>,
     jell::inplace_vector<std::size_t, 23>,
+    jell::inplace_vector<std::size_t, 255>,
     jell::inplace_vector<NonTrivial, 29>,
-    jell::inplace_vector<MoveOnly, 31>
+    jell::inplace_vector<MoveOnly, 31>,
+    jell::inplace_vector<SizedCopy, 37>,
+    jell::inplace_vector<Relocatable, 41>
 >;
 TYPED_TEST_SUITE(InplaceVectorTest, vector_types);
 
@@ -203,7 +299,7 @@ TYPED_TEST(InplaceVectorTest, size_constructor_overflow)
 {
     constexpr auto count = TypeParam::capacity() + 1;
 
-    EXPECT_THROW((TypeParam(count)), std::bad_alloc);
+    EXPECT_THROW_OR_DEATH((TypeParam(count)), std::bad_alloc);
 }
 
 TYPED_TEST(InplaceVectorTest, is_size_value_constructible)
@@ -221,7 +317,7 @@ TYPED_TEST(InplaceVectorTest, size_value_constructor_overflow)
     if constexpr (std::is_copy_constructible_v<typename TypeParam::value_type>) {
         constexpr auto count = TypeParam::capacity() + 1;
 
-        EXPECT_THROW((TypeParam(count, typename TypeParam::value_type{100})), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH((TypeParam(count, typename TypeParam::value_type{100})), std::bad_alloc);
     }
 }
 
@@ -248,6 +344,7 @@ TYPED_TEST(InplaceVectorTest, is_copy_constructible)
     }
 }
 
+#if defined(__cpp_exceptions)
 TEST(InplaceVectorTest, handles_throw_in_copy_constructor)
 {
     const std::size_t size = 4;
@@ -269,6 +366,7 @@ TEST(InplaceVectorTest, handles_throw_in_move_constructor)
 
     EXPECT_THROW((inplace_vector{std::move(v)}), std::runtime_error);
 }
+#endif // __cpp_exceptions
 
 TYPED_TEST(InplaceVectorTest, is_move_constructible)
 {
@@ -408,8 +506,8 @@ TYPED_TEST(InplaceVectorTest, at_out_of_range)
 {
     TypeParam v;
     const TypeParam cv{};
-    EXPECT_THROW(v.at(1), std::out_of_range);
-    EXPECT_THROW(cv.at(1), std::out_of_range);
+    EXPECT_THROW_OR_DEATH(v.at(1), std::out_of_range);
+    EXPECT_THROW_OR_DEATH(cv.at(1), std::out_of_range);
 }
 
 TYPED_TEST(InplaceVectorTest, index_in_range)
@@ -524,6 +622,99 @@ TYPED_TEST(InplaceVectorTest, can_resize_value_larger)
     }
 }
 
+TYPED_TEST(InplaceVectorTest, handles_resize_overflow)
+{
+    TypeParam v;
+    EXPECT_THROW_OR_DEATH(v.resize(TypeParam::capacity() + 1), std::bad_alloc);
+    EXPECT_EQ(v.size(), 0);
+}
+
+#if defined(__cpp_exceptions)
+TEST(InplaceVectorTest, handles_throw_in_resize_value)
+{
+    const std::size_t size = 8;
+    using inplace_vector = jell::inplace_vector<ThrowOnCopyOrMoveCounter, size>;
+
+    inplace_vector v(size / 2, ThrowOnCopyOrMoveCounter{size});
+    EXPECT_THROW(v.resize(size, ThrowOnCopyOrMoveCounter{1}), std::runtime_error);
+    EXPECT_EQ(v.size(), size / 2);
+}
+#endif // __cpp_exceptions
+
+TYPED_TEST(InplaceVectorTest, is_size_default_init_constructible)
+{
+    constexpr auto count = TypeParam::capacity() / 2;
+
+    TypeParam v(count, jell::default_init);
+    EXPECT_EQ(v.size(), count);
+}
+
+TYPED_TEST(InplaceVectorTest, can_resize_default_init_smaller)
+{
+    const auto full = this->make_vector();
+
+    TypeParam v(this->make_vector());
+    v.resize(TypeParam::capacity() / 2, jell::default_init);
+    EXPECT_EQ(v.size(), TypeParam::capacity() / 2);
+    EXPECT_TRUE(std::equal(v.begin(), v.end(), full.begin(), full.begin() + v.size()));
+}
+
+TYPED_TEST(InplaceVectorTest, can_resize_default_init_larger)
+{
+    const auto half = this->make_vector(TypeParam::capacity() / 2);
+
+    TypeParam v(this->make_vector(TypeParam::capacity() / 2));
+    v.resize(TypeParam::capacity(), jell::default_init);
+    EXPECT_EQ(v.size(), TypeParam::capacity());
+    EXPECT_TRUE(std::equal(v.begin(), v.begin() + half.size(), half.begin(), half.end()));
+}
+
+TYPED_TEST(InplaceVectorTest, handles_resize_default_init_overflow)
+{
+    TypeParam v;
+    EXPECT_THROW_OR_DEATH(v.resize(TypeParam::capacity() + 1, jell::default_init), std::bad_alloc);
+}
+
+TEST(InplaceVectorTest, can_resize_and_overwrite)
+{
+    using namespace std::string_view_literals;
+    jell::inplace_vector<char, 16> v(std::from_range, "abc"sv);
+
+    v.resize_and_overwrite(v.capacity(), [](char* p, std::size_t count) {
+        EXPECT_EQ(count, 16);
+        EXPECT_EQ(std::string_view(p, 3), "abc"sv);
+        const auto text = "defgh"sv;
+        std::ranges::copy(text, p + 3);
+        return 3 + text.size();
+    });
+    EXPECT_EQ(std::string_view(v.data(), v.size()), "abcdefgh"sv);
+
+    v.resize_and_overwrite(2, [](char* p, std::size_t count) {
+        EXPECT_EQ(std::string_view(p, count), "ab"sv);
+        p[1] = 'z';
+        return count;
+    });
+    EXPECT_EQ(std::string_view(v.data(), v.size()), "az"sv);
+}
+
+TEST(InplaceVectorTest, handles_resize_and_overwrite_overflow)
+{
+    using namespace std::string_view_literals;
+    jell::inplace_vector<char, 16> v;
+    EXPECT_THROW_OR_DEATH(v.resize_and_overwrite(17, [](char*, std::size_t count) { return count; }), std::bad_alloc);
+    EXPECT_THROW_OR_DEATH(v.resize_and_overwrite(16, [](char*, std::size_t) { return 17; }), std::bad_alloc);
+    EXPECT_THROW_OR_DEATH(v.resize_and_overwrite(2, [](char*, std::size_t) { return 10; }), std::bad_alloc);
+    EXPECT_TRUE(v.empty());
+
+    jell::inplace_vector<char, 16, jell::saturate_on_overflow> saturated;
+    saturated.resize_and_overwrite(2, [](char* p, std::size_t) {
+        p[0] = 'a';
+        p[1] = 'b';
+        return 10;
+    });
+    EXPECT_EQ(std::string_view(saturated.data(), saturated.size()), "ab"sv);
+}
+
 TYPED_TEST(InplaceVectorTest, reserve_below_capacity)
 {
     TypeParam v;
@@ -534,7 +725,7 @@ TYPED_TEST(InplaceVectorTest, reserve_below_capacity)
 TYPED_TEST(InplaceVectorTest, reserve_above_capacity)
 {
     TypeParam v;
-    EXPECT_THROW(v.reserve(TypeParam::capacity() + 1), std::bad_alloc);
+    EXPECT_THROW_OR_DEATH(v.reserve(TypeParam::capacity() + 1), std::bad_alloc);
 }
 
 TYPED_TEST(InplaceVectorTest, shrink_to_fit)
@@ -580,7 +771,7 @@ TYPED_TEST(InplaceVectorTest, handles_insert_overflow)
     if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
         TypeParam v(this->make_vector());
         const auto value = typename TypeParam::value_type{999};
-        EXPECT_THROW(v.insert(v.begin(), value), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.insert(v.begin(), value), std::bad_alloc);
     }
 }
 
@@ -625,7 +816,7 @@ TYPED_TEST(InplaceVectorTest, handles_move_insert_overflow)
     if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
         TypeParam v(this->make_vector());
         auto value = typename TypeParam::value_type{999};
-        EXPECT_THROW(v.insert(v.begin(), std::move(value)), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.insert(v.begin(), std::move(value)), std::bad_alloc);
     }
 }
 
@@ -672,7 +863,7 @@ TYPED_TEST(InplaceVectorTest, handles_count_insert_overflow)
     if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
         TypeParam v(this->make_vector());
         auto value = typename TypeParam::value_type{999};
-        EXPECT_THROW(v.insert(v.begin(), 1, value), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.insert(v.begin(), 1, value), std::bad_alloc);
     }
 }
 
@@ -741,7 +932,7 @@ TYPED_TEST(InplaceVectorTest, handles_iterator_insert_overflow)
     if constexpr (TypeParam::capacity() != 0) {
         TypeParam v(this->make_vector());
         TypeParam v_insert(this->make_vector(1));
-        EXPECT_THROW(v.insert(v.begin(),
+        EXPECT_THROW_OR_DEATH(v.insert(v.begin(),
                               std::make_move_iterator(v_insert.begin()),
                               std::make_move_iterator(v_insert.end())),
                      std::bad_alloc);
@@ -755,7 +946,7 @@ TYPED_TEST(InplaceVectorTest, handles_iterator_insert_overflow_without_random_ac
         TypeParam v_insert(this->make_vector(1));
         const auto first = MoveInputIterator{v_insert.begin()};
         const auto last  = MoveInputIterator{v_insert.end()};
-        EXPECT_THROW(v.insert(v.begin(), first, last), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.insert(v.begin(), first, last), std::bad_alloc);
     }
 }
 
@@ -785,11 +976,60 @@ TYPED_TEST(InplaceVectorTest, can_insert_range)
     EXPECT_TRUE(std::equal(v.begin() + half.size(), v.end(), half.begin(), half.end()));
 }
 
+TEST(InplaceVectorTest, can_insert_sized_range)
+{
+    const std::list<std::size_t> list{10, 11, 12};
+    jell::inplace_vector<std::size_t, 9> v{1, 2, 3};
+
+    const auto pos = v.insert_range(v.begin() + 1, list);
+    EXPECT_EQ(pos, v.begin() + 1);
+    EXPECT_THAT(v, testing::ElementsAre(1, 10, 11, 12, 2, 3));
+
+    v.insert_range(v.end(), list | std::views::transform([](std::size_t value) { return value * 2; }));
+    EXPECT_THAT(v, testing::ElementsAre(1, 10, 11, 12, 2, 3, 20, 22, 24));
+}
+
+TEST(InplaceVectorTest, can_insert_forward_range)
+{
+    const std::forward_list<std::size_t> list{10, 11, 12, 13};
+    jell::inplace_vector<std::size_t, 8> v{1, 2, 3};
+
+    v.insert(v.begin() + 2, list.begin(), list.end());
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 10, 11, 12, 13, 3));
+}
+
+TEST(InplaceVectorTest, handles_sized_range_overflow_before_moving)
+{
+    const std::list<std::size_t> list{10, 11, 12};
+    jell::inplace_vector<std::size_t, 4> v{1, 2, 3};
+
+    EXPECT_THROW_OR_DEATH(v.insert_range(v.begin(), list), std::bad_alloc);
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 3));
+    EXPECT_THROW_OR_DEATH(v.append_range(list), std::bad_alloc);
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 3));
+}
+
+TEST(InplaceVectorTest, can_assign_and_construct_from_sized_ranges)
+{
+    const std::list<std::size_t> list{10, 11, 12};
+    using inplace_vector = jell::inplace_vector<std::size_t, 8>;
+
+    inplace_vector v{1, 2, 3, 4, 5};
+    v.assign_range(std::ranges::subrange(list.begin(), list.end(), list.size()));
+    EXPECT_THAT(v, testing::ElementsAre(10, 11, 12));
+
+    v.assign(list.begin(), list.end());
+    EXPECT_THAT(v, testing::ElementsAre(10, 11, 12));
+
+    const inplace_vector odd(std::from_range, list | std::views::filter([](std::size_t value) { return value % 2; }));
+    EXPECT_THAT(odd, testing::ElementsAre(11));
+}
+
 TYPED_TEST(InplaceVectorTest, handles_insert_range_overflow)
 {
     if constexpr (TypeParam::capacity() != 0) {
         TypeParam v(this->make_vector());
-        EXPECT_THROW(v.insert_range(v.begin(), this->make_vector(1) | std::views::as_rvalue), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.insert_range(v.begin(), this->make_vector(1) | std::views::as_rvalue), std::bad_alloc);
     }
 }
 
@@ -831,10 +1071,71 @@ TYPED_TEST(InplaceVectorTest, handles_emplace_overflow)
 {
     if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
         TypeParam v(this->make_vector());
-        EXPECT_THROW(v.emplace(v.begin(), 999), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.emplace(v.begin(), 999), std::bad_alloc);
+    }
+}
+
+TYPED_TEST(InplaceVectorTest, can_insert_through_session)
+{
+    if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
+        using value_type = typename TypeParam::value_type;
+        const auto half = this->make_vector(TypeParam::capacity() / 2);
+        const auto count = TypeParam::capacity() - half.size();
+        const auto split = half.size() / 2;
+
+        TypeParam v(half);
+        {
+            auto session = v.open_insertion(v.begin() + split);
+            for (std::size_t i = 0; i != count; ++i) {
+                EXPECT_EQ(*session.emplace(200 + i), value_type{200 + i});
+            }
+            EXPECT_THROW_OR_DEATH(session.emplace(999), std::bad_alloc);
+        }
+
+        EXPECT_EQ(v.size(), half.size() + count);
+        EXPECT_TRUE(std::equal(v.begin(), v.begin() + split, half.begin(), half.begin() + split));
+        for (std::size_t i = 0; i != count; ++i) {
+            EXPECT_EQ(v[split + i], value_type{200 + i});
+        }
+        EXPECT_TRUE(std::equal(v.begin() + split + count, v.end(), half.begin() + split, half.end()));
     }
 }
 
+TYPED_TEST(InplaceVectorTest, can_commit_session)
+{
+    if constexpr (TypeParam::capacity() != 0 && std::is_copy_constructible_v<typename TypeParam::value_type>) {
+        const auto half = this->make_vector(TypeParam::capacity() / 2);
+        const auto value = typename TypeParam::value_type{200};
+
+        TypeParam v(half);
+        auto session = v.open_insertion(v.begin());
+        session.insert(value);
+        session.commit();
+
+        EXPECT_EQ(v.size(), half.size() + 1);
+        EXPECT_EQ(v.front(), value);
+        EXPECT_TRUE(std::equal(v.begin() + 1, v.end(), half.begin(), half.end()));
+    }
+}
+
+#if defined(__cpp_exceptions)
+TEST(InplaceVectorTest, handles_throw_in_session)
+{
+    const std::size_t size = 8;
+    using inplace_vector = jell::inplace_vector<ThrowOnCopyOrMoveCounter, size>;
+
+    inplace_vector v(size / 2, ThrowOnCopyOrMoveCounter{size});
+    EXPECT_THROW(
+        {
+            auto session = v.open_insertion(v.begin() + 1);
+            session.insert(ThrowOnCopyOrMoveCounter{size});
+            session.insert(ThrowOnCopyOrMoveCounter{1});
+        },
+        std::runtime_error);
+    EXPECT_EQ(v.size(), 2);
+}
+#endif // __cpp_exceptions
+
 TYPED_TEST(InplaceVectorTest, can_emplace_back)
 {
     if constexpr (TypeParam::capacity() != 0) {
@@ -849,7 +1150,7 @@ TYPED_TEST(InplaceVectorTest, can_emplace_back)
 TYPED_TEST(InplaceVectorTest, handles_emplace_back_overflow)
 {
     auto full = this->make_vector();
-    EXPECT_THROW(full.emplace_back(typename TypeParam::value_type{999}), std::bad_alloc);
+    EXPECT_THROW_OR_DEATH(full.emplace_back(typename TypeParam::value_type{999}), std::bad_alloc);
 }
 
 TYPED_TEST(InplaceVectorTest, can_try_emplace_back)
@@ -935,7 +1236,7 @@ TYPED_TEST(InplaceVectorTest, handles_append_range_overflow)
 {
     if constexpr (TypeParam::capacity() != 0) {
         TypeParam v(this->make_vector());
-        EXPECT_THROW(v.append_range(this->make_vector(1) | std::views::as_rvalue), std::bad_alloc);
+        EXPECT_THROW_OR_DEATH(v.append_range(this->make_vector(1) | std::views::as_rvalue), std::bad_alloc);
     }
 }
 
@@ -962,6 +1263,229 @@ TYPED_TEST(InplaceVectorTest, handles_try_append_range_overflow)
     }
 }
 
+TEST(InplaceVectorTest, can_append_input_range)
+{
+    std::istringstream stream{"1 2 3"};
+    jell::inplace_vector<std::size_t, 8> v{10};
+
+    v.append_range(std::views::istream<std::size_t>(stream));
+    EXPECT_THAT(v, testing::ElementsAre(10, 1, 2, 3));
+}
+
+TEST(InplaceVectorTest, handles_append_input_range_overflow)
+{
+    std::istringstream stream{"1 2 3 4"};
+    jell::inplace_vector<std::size_t, 4> v{10};
+
+    EXPECT_THROW_OR_DEATH(v.append_range(std::views::istream<std::size_t>(stream)), std::bad_alloc);
+    EXPECT_THAT(v, testing::ElementsAre(10));
+}
+
+TEST(InplaceVectorTest, can_try_append_input_range)
+{
+    std::istringstream stream{"1 2 3 4 5"};
+    jell::inplace_vector<std::size_t, 4> v{10};
+
+    auto input = std::views::istream<std::size_t>(stream);
+    auto pos = v.try_append_range(input);
+    EXPECT_THAT(v, testing::ElementsAre(10, 1, 2, 3));
+    ASSERT_NE(pos, std::ranges::end(input));
+    EXPECT_EQ(*pos, 4);
+}
+
+TEST(InplaceVectorTest, moves_from_input_range)
+{
+    std::istringstream stream{"1 2 3"};
+    jell::inplace_vector<std::unique_ptr<int>, 4> v;
+
+    auto input = std::views::istream<int>(stream) |
+                 std::views::transform([](int value) { return std::make_unique<int>(value); });
+    v.try_append_range(input);
+    ASSERT_EQ(v.size(), 3);
+    EXPECT_EQ(*v[0], 1);
+    EXPECT_EQ(*v[2], 3);
+}
+
+TYPED_TEST(InplaceVectorTest, can_try_emplace_and_insert)
+{
+    using value_type = typename TypeParam::value_type;
+
+    auto v = this->make_vector(TypeParam::capacity() / 2);
+    if constexpr (TypeParam::capacity() != 0) {
+        const auto pos = v.try_emplace(v.begin(), 999uz);
+        ASSERT_TRUE(pos.has_value());
+        EXPECT_EQ(*pos, v.begin());
+        EXPECT_EQ(v.front(), value_type{999});
+        EXPECT_TRUE(v.try_insert(v.end(), value_type{998}).has_value());
+        EXPECT_EQ(v.back(), value_type{998});
+    }
+
+    auto full = this->make_vector();
+    EXPECT_EQ(full.try_emplace(full.begin(), 999uz).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(full.try_insert(full.end(), value_type{999}).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(full, this->make_vector());
+}
+
+TEST(InplaceVectorTest, can_try_insert_ranges)
+{
+    jell::inplace_vector<int, 6> v{1, 2};
+
+    EXPECT_EQ(v.try_insert(v.begin() + 1, 2, 7).value(), v.begin() + 1);
+    EXPECT_EQ(v.try_insert(v.begin(), 3, 8).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(v.try_insert(v.begin(), {5, 6, 7}).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(v.try_insert_range(v.end(), std::list<int>{8, 9}).value(), v.begin() + 4);
+    EXPECT_THAT(v, testing::ElementsAre(1, 7, 7, 2, 8, 9));
+
+    v.resize(3);
+    std::istringstream fits{"4 5"};
+    EXPECT_EQ(v.try_insert_range(v.begin() + 1, std::views::istream<int>(fits)).value(), v.begin() + 1);
+    EXPECT_THAT(v, testing::ElementsAre(1, 4, 5, 7, 7));
+
+    std::istringstream overflows{"6 7"};
+    EXPECT_EQ(v.try_insert_range(v.begin() + 1, std::views::istream<int>(overflows)).error(),
+              jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_THAT(v, testing::ElementsAre(1, 4, 5, 7, 7));
+}
+
+TEST(InplaceVectorTest, can_try_assign)
+{
+    jell::inplace_vector<int, 4> v{1, 2};
+
+    EXPECT_TRUE(v.try_assign(3, 7).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(7, 7, 7));
+    EXPECT_EQ(v.try_assign(5, 8).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(v.try_assign({1, 2, 3, 4, 5}).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_THAT(v, testing::ElementsAre(7, 7, 7));
+    EXPECT_TRUE(v.try_assign_range(std::vector<int>{1, 2, 3, 4}).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 3, 4));
+
+    std::istringstream fits{"5 6"};
+    EXPECT_TRUE(v.try_assign_range(std::views::istream<int>(fits)).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(5, 6));
+
+    std::istringstream overflows{"1 2 3 4 5"};
+    EXPECT_EQ(v.try_assign_range(std::views::istream<int>(overflows)).error(),
+              jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(InplaceVectorTest, can_try_resize)
+{
+    jell::inplace_vector<int, 4> v{1, 2};
+
+    EXPECT_TRUE(v.try_resize(3).has_value());
+    EXPECT_TRUE(v.try_resize(4, 7).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(1, 2, 0, 7));
+    EXPECT_EQ(v.try_resize(5).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(v.try_resize(5, 7).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_EQ(v.try_resize(5, jell::default_init).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_TRUE(v.try_resize(1, jell::default_init).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(1));
+}
+
+TEST(InplaceVectorTest, can_try_at)
+{
+    jell::inplace_vector<int, 4> v{1, 2};
+    const auto& cv = v;
+
+    v.try_at(1)->get() = 3;
+    EXPECT_EQ(cv.try_at(1)->get(), 3);
+    EXPECT_EQ(v.try_at(2).error(), jell::inplace_vector_errc::out_of_range);
+    EXPECT_EQ(cv.try_at(2).error(), jell::inplace_vector_errc::out_of_range);
+}
+
+TEST(InplaceVectorTest, can_try_from_range)
+{
+    using inplace_vector = jell::inplace_vector<int, 4>;
+
+    EXPECT_THAT(inplace_vector::try_from_range(std::vector<int>{1, 2, 3}).value(), testing::ElementsAre(1, 2, 3));
+    EXPECT_EQ(inplace_vector::try_from_range(std::views::iota(0, 5)).error(),
+              jell::inplace_vector_errc::capacity_exceeded);
+}
+
+TEST(InplaceVectorTest, can_copy_from_empty_contiguous_range)
+{
+    // An empty std::vector has a null data(), which must not reach memcpy.
+    const std::vector<int> empty;
+    jell::inplace_vector<int, 4> v(empty.begin(), empty.end());
+    EXPECT_TRUE(v.empty());
+    v.append_range(empty);
+    v.assign_range(empty);
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(v.try_append_range(empty), empty.end());
+    EXPECT_TRUE((jell::inplace_vector<int, 4>(std::from_range, empty)).empty());
+
+    jell::inplace_vector<int, 4> other;
+    v = other;
+    v.swap(other);
+    EXPECT_TRUE(v.empty());
+    v = jell::inplace_vector<int, 0>{};
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(InplaceVectorTest, try_operations_bypass_overflow_policy)
+{
+    jell::inplace_vector<int, 2, jell::abort_on_overflow> v{1, 2};
+
+    EXPECT_FALSE(v.try_insert(v.begin(), 3).has_value());
+    EXPECT_FALSE(v.try_resize(3).has_value());
+    EXPECT_FALSE(v.try_assign(3, 0).has_value());
+    EXPECT_THAT(v, testing::ElementsAre(1, 2));
+}
+
+using AtomicVector = jell::inplace_vector<std::atomic<std::uint64_t>, 4>;
+
+static_assert(!std::is_copy_constructible_v<AtomicVector>);
+static_assert(!std::is_move_constructible_v<AtomicVector>);
+static_assert(!std::is_move_assignable_v<AtomicVector>);
+static_assert(!std::is_swappable_v<AtomicVector>);
+
+template <typename Vector>
+concept can_insert_element = requires(Vector v) { v.emplace(v.begin(), 1u); };
+
+template <typename Vector>
+concept can_erase_element = requires(Vector v) {
+    v.erase(v.begin());
+    v.unordered_erase(v.begin());
+    std::erase_if(v, [](const auto&) { return true; });
+};
+
+static_assert(can_insert_element<jell::inplace_vector<std::uint64_t, 4>>);
+static_assert(can_erase_element<jell::inplace_vector<std::uint64_t, 4>>);
+static_assert(!can_insert_element<AtomicVector>);
+static_assert(!can_erase_element<AtomicVector>);
+
+TEST(InplaceVectorTest, supports_non_movable_elements)
+{
+    AtomicVector v;
+    v.emplace_back(1u);
+    ASSERT_NE(v.try_emplace_back(2u), nullptr);
+    v.resize(4);
+    v[3].fetch_add(5);
+
+    std::uint64_t sum = 0;
+    for (const auto& element : v) {
+        sum += element.load();
+    }
+    EXPECT_EQ(sum, 8);
+
+    v.pop_back();
+    v.resize(1);
+    EXPECT_EQ(v.front().load(), 1);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+
+    const jell::inplace_vector<std::atomic<int>, 4> from_range(std::from_range, std::views::iota(0, 3));
+    EXPECT_EQ(from_range.size(), 3);
+    EXPECT_EQ(from_range.back().load(), 2);
+
+    jell::inplace_vector<std::mutex, 2> mutexes(2);
+    for (auto& mutex : mutexes) {
+        const std::lock_guard lock{mutex};
+    }
+    EXPECT_EQ(mutexes.size(), 2);
+}
+
 TYPED_TEST(InplaceVectorTest, can_clear)
 {
     auto v = this->make_vector();
@@ -980,6 +1504,72 @@ TYPED_TEST(InplaceVectorTest, can_erase_single)
     }
 }
 
+TYPED_TEST(InplaceVectorTest, can_unordered_erase)
+{
+    if constexpr (TypeParam::capacity() != 0) {
+        auto v = this->make_vector();
+        const auto expected = this->make_vector();
+        const auto result_iter = v.unordered_erase(v.begin());
+        EXPECT_EQ(result_iter, v.begin());
+        EXPECT_EQ(v.size(), expected.size() - 1);
+        if (!v.empty()) {
+            EXPECT_EQ(v.front(), expected.back());
+            EXPECT_TRUE(std::equal(v.begin() + 1, v.end(), expected.begin() + 1, expected.end() - 1));
+        }
+    }
+}
+
+TYPED_TEST(InplaceVectorTest, can_unordered_erase_last)
+{
+    if constexpr (TypeParam::capacity() != 0) {
+        auto v = this->make_vector();
+        const auto expected = this->make_vector();
+        const auto result_iter = v.unordered_erase(v.end() - 1);
+        EXPECT_EQ(result_iter, v.end());
+        EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(), expected.end() - 1));
+    }
+}
+
+TYPED_TEST(InplaceVectorTest, can_unordered_erase_predicate)
+{
+    auto v = this->make_vector();
+    EXPECT_EQ(v.unordered_erase_if([](const auto&) { return false; }), 0);
+    EXPECT_EQ(v, this->make_vector());
+
+    const auto erase_count = v.unordered_erase_if([](const auto&) { return true; });
+    EXPECT_EQ(erase_count, TypeParam::capacity());
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(InplaceVectorTest, can_unordered_erase_predicate_values)
+{
+    jell::inplace_vector<int, 16> v{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    EXPECT_EQ(v.unordered_erase_if([](int value) { return value % 3 != 0; }), 6);
+    EXPECT_THAT(v, testing::UnorderedElementsAre(3, 6, 9));
+}
+
+TYPED_TEST(InplaceVectorTest, can_erase_indices)
+{
+    auto v = this->make_vector();
+    const auto expected = this->make_vector();
+    auto indices = std::views::iota(0uz, v.size()) | std::views::filter([](std::size_t i) { return i % 3 != 1; });
+    const auto erase_count = v.erase_indices(indices);
+    EXPECT_EQ(erase_count, expected.size() - v.size());
+    EXPECT_EQ(v.size(), expected.size() / 3 + (expected.size() % 3 == 2 ? 1 : 0));
+    for (std::size_t i = 0; i != v.size(); ++i) {
+        EXPECT_EQ(v[i], expected[i * 3 + 1]);
+    }
+}
+
+TEST(InplaceVectorTest, can_erase_indices_values)
+{
+    jell::inplace_vector<std::string, 8> v{"a", "b", "c", "d", "e", "f"};
+    EXPECT_EQ(v.erase_indices(std::vector<std::size_t>{0, 2, 3, 5}), 4);
+    EXPECT_THAT(v, testing::ElementsAre("b", "e"));
+    EXPECT_EQ(v.erase_indices(std::vector<std::size_t>{}), 0);
+    EXPECT_THAT(v, testing::ElementsAre("b", "e"));
+}
+
 TYPED_TEST(InplaceVectorTest, can_erase_single_last)
 {
     if constexpr (TypeParam::capacity() != 0) {
@@ -1088,6 +1678,208 @@ TYPED_TEST(InplaceVectorTest, can_erase_predicate)
     EXPECT_EQ(std::count(v.begin(), v.end(), expected_value), v.size());
 }
 
+TEST(InplaceVectorTest, can_compare_bytes)
+{
+    using inplace_vector = jell::inplace_vector<std::uint8_t, 64>;
+
+    const inplace_vector abc{1, 2, 200};
+    EXPECT_EQ(abc, (inplace_vector{1, 2, 200}));
+    EXPECT_NE(abc, (inplace_vector{1, 2}));
+    EXPECT_NE(abc, (inplace_vector{1, 2, 201}));
+    EXPECT_EQ(inplace_vector{}, inplace_vector{});
+
+    EXPECT_EQ(abc <=> (inplace_vector{1, 2, 200}), std::strong_ordering::equal);
+    EXPECT_EQ(abc <=> (inplace_vector{1, 2, 100}), std::strong_ordering::greater);
+    EXPECT_EQ(abc <=> (inplace_vector{1, 3}), std::strong_ordering::less);
+    EXPECT_EQ(abc <=> (inplace_vector{1, 2}), std::strong_ordering::greater);
+    EXPECT_EQ(abc <=> (inplace_vector{1, 2, 200, 0}), std::strong_ordering::less);
+    EXPECT_EQ(inplace_vector{} <=> inplace_vector{}, std::strong_ordering::equal);
+}
+
+TEST(InplaceVectorTest, can_compare_signed_values)
+{
+    using inplace_vector = jell::inplace_vector<std::int32_t, 8>;
+
+    const inplace_vector v{-1, 2};
+    EXPECT_EQ(v, (inplace_vector{-1, 2}));
+    EXPECT_EQ(v <=> (inplace_vector{1, 2}), std::strong_ordering::less);
+    EXPECT_EQ(v <=> (inplace_vector{-2, 2}), std::strong_ordering::greater);
+}
+
+TEST(InplaceVectorTest, can_compare_floating_point_values)
+{
+    using inplace_vector = jell::inplace_vector<double, 8>;
+
+    EXPECT_EQ((inplace_vector{0.0}), (inplace_vector{-0.0}));
+    EXPECT_NE((inplace_vector{std::nan("")}), (inplace_vector{std::nan("")}));
+}
+
+namespace {
+
+/// Colours with two spellings each, which operator== treats as equal.
+enum class Colour : std::uint8_t { red, rouge, green, vert };
+
+constexpr bool operator==(Colour lhs, Colour rhs)
+{
+    return std::to_underlying(lhs) / 2 == std::to_underlying(rhs) / 2;
+}
+
+enum class Shape : std::uint8_t { circle, square };
+
+} // namespace
+
+// Enumerations are compared with memcmp only when they use the built-in operator==.
+static_assert(!jell::detail::inplace_vector::is_bytewise_equality_comparable_v<Colour>);
+static_assert(jell::detail::inplace_vector::is_bytewise_equality_comparable_v<Shape>);
+
+TEST(InplaceVectorTest, can_compare_enums_with_custom_equality)
+{
+    using inplace_vector = jell::inplace_vector<Colour, 8>;
+
+    EXPECT_EQ((inplace_vector{Colour::red, Colour::green}), (inplace_vector{Colour::rouge, Colour::vert}));
+    EXPECT_NE((inplace_vector{Colour::red, Colour::green}), (inplace_vector{Colour::green, Colour::red}));
+    EXPECT_EQ((jell::inplace_vector<Shape, 8>{Shape::circle}), (jell::inplace_vector<Shape, 8>{Shape::circle}));
+    EXPECT_NE((jell::inplace_vector<Shape, 8>{Shape::circle}), (jell::inplace_vector<Shape, 8>{Shape::square}));
+}
+
+static_assert(std::is_nothrow_convertible_v<const jell::inplace_vector<int, 4>&, jell::inplace_vector<int, 8>>);
+static_assert(std::is_nothrow_constructible_v<jell::inplace_vector<Relocatable, 8>,
+                                             jell::inplace_vector<Relocatable, 4>&&>);
+static_assert(!std::is_convertible_v<const jell::inplace_vector<int, 8>&, jell::inplace_vector<int, 4>>);
+static_assert(std::is_constructible_v<jell::inplace_vector<int, 4>, const jell::inplace_vector<int, 8>&>);
+static_assert(std::is_nothrow_assignable_v<jell::inplace_vector<int, 8>&, const jell::inplace_vector<int, 4>&>);
+static_assert(!std::is_nothrow_assignable_v<jell::inplace_vector<int, 4>&, const jell::inplace_vector<int, 8>&>);
+
+TEST(InplaceVectorTest, can_convert_between_capacities)
+{
+    const jell::inplace_vector<int, 4> small{1, 2, 3};
+    const jell::inplace_vector<int, 8> large = small;
+    EXPECT_THAT(large, testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT((jell::inplace_vector<int, 3>(large)), testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT((jell::inplace_vector<int, 0>(jell::inplace_vector<int, 4>{})), testing::IsEmpty());
+    EXPECT_THROW_OR_DEATH((jell::inplace_vector<int, 2>(large)), std::bad_alloc);
+
+    jell::inplace_vector<std::string, 2> strings{"a", std::string(32, 'b')};
+    const jell::inplace_vector<std::string, 4> moved = std::move(strings);
+    EXPECT_THAT(moved, testing::ElementsAre("a", std::string(32, 'b')));
+    EXPECT_TRUE(strings.empty());
+
+    jell::inplace_vector<Relocatable, 2> relocatable{1, 2};
+    const jell::inplace_vector<Relocatable, 4> relocated = std::move(relocatable);
+    EXPECT_THAT(relocated, testing::ElementsAre(Relocatable{1}, Relocatable{2}));
+    EXPECT_TRUE(relocatable.empty());
+
+    const jell::inplace_vector<int, 4, jell::saturate_on_overflow> saturated(
+        jell::inplace_vector<int, 6>{1, 2, 3, 4, 5});
+    EXPECT_THAT(saturated, testing::ElementsAre(1, 2, 3, 4));
+}
+
+TEST(InplaceVectorTest, can_assign_between_capacities)
+{
+    jell::inplace_vector<int, 4> small{1, 2, 3};
+    jell::inplace_vector<int, 8> large{4, 5};
+
+    large = small;
+    EXPECT_THAT(large, testing::ElementsAre(1, 2, 3));
+    large.push_back(4);
+    small = large;
+    EXPECT_THAT(small, testing::ElementsAre(1, 2, 3, 4));
+    large.push_back(5);
+    EXPECT_THROW_OR_DEATH(small = large, std::bad_alloc);
+    EXPECT_EQ(small.try_assign(large).error(), jell::inplace_vector_errc::capacity_exceeded);
+    EXPECT_THAT(small, testing::ElementsAre(1, 2, 3, 4));
+    EXPECT_FALSE(small.try_assign(std::move(large)).has_value());
+    EXPECT_EQ(large.size(), 5);
+    large.pop_back();
+    EXPECT_TRUE(small.try_assign(std::move(large)).has_value());
+    EXPECT_TRUE(large.empty());
+
+    jell::inplace_vector<std::string, 2> strings{"a"};
+    jell::inplace_vector<std::string, 4> more_strings{"b", "c", std::string(32, 'd')};
+    more_strings.pop_back();
+    strings = std::move(more_strings);
+    EXPECT_THAT(strings, testing::ElementsAre("b", "c"));
+    EXPECT_TRUE(more_strings.empty());
+
+    jell::inplace_vector<std::string, 2> same_strings{"e"};
+    same_strings = std::move(strings);
+    EXPECT_THAT(same_strings, testing::ElementsAre("b", "c"));
+    EXPECT_TRUE(strings.empty());
+}
+
+TEST(InplaceVectorTest, can_compare_between_capacities)
+{
+    const jell::inplace_vector<int, 4> small{1, 2, 3};
+    const jell::inplace_vector<int, 8> large{1, 2, 3};
+    const jell::inplace_vector<int, 4, jell::saturate_on_overflow> saturating{1, 2, 4};
+
+    EXPECT_EQ(small, large);
+    EXPECT_EQ(large, small);
+    EXPECT_NE(small, saturating);
+    EXPECT_LT(small, saturating);
+    EXPECT_GT(saturating, large);
+    EXPECT_EQ(small <=> (jell::inplace_vector<int, 8>{1, 2}), std::strong_ordering::greater);
+}
+
+TEST(InplaceVectorTest, can_concat)
+{
+    const jell::inplace_vector<int, 4> lhs{1, 2};
+    const jell::inplace_vector<int, 3> rhs{3, 4, 5};
+
+    const auto joined = jell::concat(lhs, rhs);
+    static_assert(std::is_same_v<decltype(joined), const jell::inplace_vector<int, 7>>);
+    EXPECT_THAT(joined, testing::ElementsAre(1, 2, 3, 4, 5));
+    EXPECT_THAT(jell::concat(rhs, jell::inplace_vector<int, 0>{}), testing::ElementsAre(3, 4, 5));
+
+    jell::inplace_vector<Relocatable, 2> first{1, 2};
+    jell::inplace_vector<Relocatable, 2> second{3};
+    const auto relocated = jell::concat(std::move(first), std::move(second));
+    EXPECT_THAT(relocated, testing::ElementsAre(Relocatable{1}, Relocatable{2}, Relocatable{3}));
+    EXPECT_TRUE(first.empty());
+    EXPECT_TRUE(second.empty());
+
+    jell::inplace_vector<std::string, 1> strings{"a"};
+    const auto moved = jell::concat(std::move(strings), jell::inplace_vector<std::string, 2>{std::string(32, 'b')});
+    EXPECT_THAT(moved, testing::ElementsAre("a", std::string(32, 'b')));
+}
+
+TEST(InplaceVectorTest, can_split_at)
+{
+    const jell::inplace_vector<int, 8> v{1, 2, 3, 4, 5};
+
+    const auto [head, tail] = jell::split_at<2>(v);
+    static_assert(std::is_same_v<decltype(head), const jell::inplace_vector<int, 2>>);
+    static_assert(std::is_same_v<decltype(tail), const jell::inplace_vector<int, 6>>);
+    EXPECT_THAT(head, testing::ElementsAre(1, 2));
+    EXPECT_THAT(tail, testing::ElementsAre(3, 4, 5));
+
+    const auto [all, none] = jell::split_at<6>(v);
+    EXPECT_EQ(all, v);
+    EXPECT_TRUE(none.empty());
+
+    jell::inplace_vector<Relocatable, 4> relocatable{1, 2, 3};
+    const auto [first, rest] = jell::split_at<1>(std::move(relocatable));
+    EXPECT_THAT(first, testing::ElementsAre(Relocatable{1}));
+    EXPECT_THAT(rest, testing::ElementsAre(Relocatable{2}, Relocatable{3}));
+    EXPECT_TRUE(relocatable.empty());
+}
+
+TEST(InplaceVectorTest, can_split)
+{
+    const jell::inplace_vector<int, 8> v{1, 2, 3, 4, 5};
+
+    const auto [head, tail] = jell::split(v, 3);
+    EXPECT_THAT(head, testing::ElementsAre(1, 2, 3));
+    EXPECT_THAT(tail, testing::ElementsAre(4, 5));
+    EXPECT_TRUE(jell::split(v, 9).second.empty());
+
+    jell::inplace_vector<std::string, 4> strings{"a", "b", std::string(32, 'c')};
+    const auto [first, rest] = jell::split(std::move(strings), 1);
+    EXPECT_THAT(first, testing::ElementsAre("a"));
+    EXPECT_THAT(rest, testing::ElementsAre("b", std::string(32, 'c')));
+    EXPECT_TRUE(strings.empty());
+}
+
 TYPED_TEST(InplaceVectorTest, can_compare_iterators)
 {
     TypeParam v;
@@ -1118,8 +1910,8 @@ TYPED_TEST(InplaceVectorTest, cant_dereference_iterators_past_end)
 #if defined(CHECKED_ITERATORS)
     if constexpr (TypeParam::capacity() != 0) {
         auto v = this->make_vector(1);
-        EXPECT_THROW(*v.end(), std::range_error);
-        EXPECT_THROW(*v.cend(), std::range_error);
+        EXPECT_THROW_OR_DEATH(*v.end(), std::range_error);
+        EXPECT_THROW_OR_DEATH(*v.cend(), std::range_error);
     }
 #endif
 }
@@ -1128,8 +1920,8 @@ TYPED_TEST(InplaceVectorTest, cant_increment_iterators_past_end)
 {
 #if defined(CHECKED_ITERATORS)
     TypeParam v;
-    EXPECT_THROW(++v.end(), std::range_error);
-    EXPECT_THROW(++v.cend(), std::range_error);
+    EXPECT_THROW_OR_DEATH(++v.end(), std::range_error);
+    EXPECT_THROW_OR_DEATH(++v.cend(), std::range_error);
 #endif
 }
 
@@ -1170,6 +1962,141 @@ TYPED_TEST(InplaceVectorTest, can_use_subtraction_on_iterators)
     }
 }
 
+using SaturatingVector = jell::inplace_vector<int, 4, jell::saturate_on_overflow>;
+
+static_assert(sizeof(SaturatingVector) == sizeof(jell::inplace_vector<int, 4>));
+static_assert(std::is_same_v<jell::inplace_vector<int, 4>, jell::inplace_vector<int, 4, jell::throw_on_overflow>>);
+
+// A saturating emplace_back() has no element to refer to in a zero-capacity vector.
+template <typename Vector>
+concept can_push_back = requires(Vector v, int value) {
+    v.push_back(value);
+    v.push_back(1);
+    v.emplace_back(1);
+};
+
+static_assert(can_push_back<jell::inplace_vector<int, 0>>);
+static_assert(can_push_back<jell::inplace_vector<int, 1, jell::saturate_on_overflow>>);
+static_assert(!can_push_back<jell::inplace_vector<int, 0, jell::saturate_on_overflow>>);
+static_assert(!can_push_back<jell::inplace_vector<int, 0, jell::call_on_overflow<[] {}>>>);
+static_assert(!jell::overflow_saturates<jell::abort_on_overflow>);
+
+TEST(OverflowPolicyTest, saturates_constructors_and_resize)
+{
+    EXPECT_THAT(SaturatingVector(6, 1), testing::ElementsAre(1, 1, 1, 1));
+    EXPECT_THAT((SaturatingVector{1, 2, 3, 4, 5, 6}), testing::ElementsAre(1, 2, 3, 4));
+
+    SaturatingVector v(6);
+    EXPECT_EQ(v.size(), 4);
+    v.resize(1);
+    v.resize(10, 7);
+    EXPECT_THAT(v, testing::ElementsAre(0, 7, 7, 7));
+}
+
+TEST(OverflowPolicyTest, saturates_insertion)
+{
+    SaturatingVector v{1, 2};
+    v.insert(v.begin(), {10, 11, 12});
+    EXPECT_THAT(v, testing::ElementsAre(10, 11, 1, 2));
+
+    EXPECT_EQ(v.insert(v.begin(), 20), v.begin());
+    v.emplace_back(21); // The reference returned is unspecified.
+    v.push_back(22);
+    v.append_range(std::vector<int>{23, 24});
+    EXPECT_THAT(v, testing::ElementsAre(10, 11, 1, 2));
+
+    std::istringstream stream{"30 31 32"};
+    v.resize(2);
+    v.insert_range(v.begin() + 1, std::views::istream<int>(stream));
+    EXPECT_THAT(v, testing::ElementsAre(10, 30, 31, 11));
+}
+
+TEST(OverflowPolicyTest, saturates_insertion_session)
+{
+    SaturatingVector v{1, 2, 3};
+    {
+        auto session = v.open_insertion(v.begin());
+        EXPECT_EQ(*session.emplace(10), 10);
+        EXPECT_EQ(session.emplace(11), nullptr);
+    }
+    EXPECT_THAT(v, testing::ElementsAre(10, 1, 2, 3));
+}
+
+static std::size_t overflow_count = 0;
+
+TEST(OverflowPolicyTest, calls_handler)
+{
+    using inplace_vector = jell::inplace_vector<int, 2, jell::call_on_overflow<[] { ++overflow_count; }>>;
+
+    overflow_count = 0;
+    inplace_vector v{1, 2, 3};
+    v.push_back(4);
+    v.resize(3);
+    EXPECT_EQ(overflow_count, 3);
+    EXPECT_THAT(v, testing::ElementsAre(1, 2));
+}
+
+TEST(OverflowPolicyTest, calls_handler_once_for_input_range)
+{
+    using inplace_vector = jell::inplace_vector<int, 2, jell::call_on_overflow<[] { ++overflow_count; }>>;
+
+    // The remaining input is not consumed once the vector is full.
+    overflow_count = 0;
+    std::istringstream append_stream{"1 2 3 4 5"};
+    inplace_vector appended;
+    appended.append_range(std::views::istream<int>(append_stream));
+    EXPECT_EQ(overflow_count, 1);
+    EXPECT_THAT(appended, testing::ElementsAre(1, 2));
+    EXPECT_EQ(append_stream.rdbuf()->in_avail(), 4); // " 4 5" remains.
+
+    overflow_count = 0;
+    std::istringstream assign_stream{"1 2 3 4 5"};
+    appended.assign_range(std::views::istream<int>(assign_stream));
+    EXPECT_EQ(overflow_count, 1);
+    EXPECT_THAT(appended, testing::ElementsAre(1, 2));
+
+    overflow_count = 0;
+    std::istringstream iterator_stream{"1 2 3 4 5"};
+    const inplace_vector from_iterators(std::istream_iterator<int>{iterator_stream}, std::istream_iterator<int>{});
+    EXPECT_EQ(overflow_count, 1);
+    EXPECT_THAT(from_iterators, testing::ElementsAre(1, 2));
+
+    overflow_count = 0;
+    std::istringstream range_stream{"1 2 3 4 5"};
+    const inplace_vector from_range(std::from_range, std::views::istream<int>(range_stream));
+    EXPECT_EQ(overflow_count, 1);
+    EXPECT_THAT(from_range, testing::ElementsAre(1, 2));
+}
+
+TEST(OverflowPolicyTest, aborts_on_overflow)
+{
+    jell::inplace_vector<int, 2, jell::abort_on_overflow> v{1, 2};
+    EXPECT_DEATH(v.push_back(3), "");
+}
+
+TEST(OverflowPolicyTest, traps_on_overflow)
+{
+    jell::inplace_vector<int, 2, jell::trap_on_overflow> v{1, 2};
+    EXPECT_DEATH(v.push_back(3), "");
+}
+
+#if defined(JELL_INPLACE_VECTOR_NO_EXCEPTIONS)
+TEST(ErrorHandlerTest, reports_errors_to_handler)
+{
+    const jell::error_handler handler = [](const char* message) noexcept {
+        std::fputs(message, stderr);
+        std::abort();
+    };
+    const auto previous = jell::set_error_handler(handler);
+
+    jell::inplace_vector<int, 2> v{1, 2};
+    EXPECT_DEATH(v.push_back(3), "capacity exceeded");
+    EXPECT_DEATH(v.at(2), "pos >= size");
+
+    EXPECT_EQ(jell::set_error_handler(previous), handler);
+}
+#endif // JELL_INPLACE_VECTOR_NO_EXCEPTIONS
+
 TEST(StorageTest, can_call_members_in_zero_size)
 {
     using storage_type = jell::detail::inplace_vector::storage<int, 0>;
@@ -1186,3 +2113,82 @@ TEST(StorageTest, can_call_members_in_zero_size)
     EXPECT_NO_THROW(storage.destroy(0, 0));
     EXPECT_NO_THROW(storage.clear());
 }
+
+template <typename T>
+class CompressTest : public testing::Test
+{
+protected:
+    using RemoveIf = std::size_t (*)(T*, std::size_t, std::function<bool(const T&)>&);
+
+    /// The compaction kernels supported by this CPU.
+    static std::vector<std::pair<const char*, RemoveIf>> kernels()
+    {
+        std::vector<std::pair<const char*, RemoveIf>> kernels{
+            {"scalar", &jell::detail::inplace_vector::remove_if_scalar<T, std::function<bool(const T&)>>},
+        };
+#if defined(JELL_INPLACE_VECTOR_X86_COMPRESS)
+        if (__builtin_cpu_supports("avx2")) {
+            kernels.emplace_back(
+                "avx2", &jell::detail::inplace_vector::remove_if_avx2<T, std::function<bool(const T&)>>);
+        }
+        if (__builtin_cpu_supports("avx512f")) {
+            kernels.emplace_back(
+                "avx512", &jell::detail::inplace_vector::remove_if_avx512<T, std::function<bool(const T&)>>);
+        }
+#endif
+        return kernels;
+    }
+};
+
+using compress_types = testing::Types<std::int32_t, std::uint32_t, float>;
+TYPED_TEST_SUITE(CompressTest, compress_types);
+
+TYPED_TEST(CompressTest, matches_remove_if)
+{
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int> values{-50, 50};
+
+    for (const auto& [name, kernel] : this->kernels()) {
+        for (std::size_t size = 0; size != 70; ++size) {
+            for (const int threshold : {-60, -10, 0, 25, 60}) {
+                std::vector<TypeParam> data(size);
+                std::ranges::generate(data, [&] { return static_cast<TypeParam>(values(random)); });
+
+                std::function<bool(const TypeParam&)> predicate = [threshold](const TypeParam& value) {
+                    return value < static_cast<TypeParam>(threshold);
+                };
+                auto expected = data;
+                expected.erase(std::remove_if(expected.begin(), expected.end(), predicate), expected.end());
+
+                const auto kept = kernel(data.data(), data.size(), predicate);
+                data.resize(kept);
+                EXPECT_EQ(data, expected) << name << " size=" << size << " threshold=" << threshold;
+            }
+        }
+    }
+}
+
+TEST(CompressTest, erases_floating_point_values)
+{
+    jell::inplace_vector<float, 40> v;
+    for (std::size_t i = 0; i != v.capacity(); ++i) {
+        v.push_back(i % 3 == 0 ? std::nanf("") : static_cast<float>(i % 5));
+    }
+
+    EXPECT_EQ(std::erase(v, 2.0f), 6);
+    EXPECT_EQ(std::erase_if(v, [](float value) { return std::isnan(value); }), 14);
+    EXPECT_EQ(v.size(), 20);
+    EXPECT_TRUE(std::ranges::none_of(v, [](float value) { return std::isnan(value) || value == 2.0f; }));
+}
+
+TEST(CompressTest, erases_with_non_const_reference_predicate)
+{
+    jell::inplace_vector<int, 40> v;
+    for (int i = 0; i != 40; ++i) {
+        v.push_back(i);
+    }
+
+    EXPECT_EQ(std::erase_if(v, [](int& value) { return value % 2 != 0; }), 20);
+    EXPECT_EQ(v.size(), 20);
+    EXPECT_TRUE(std::ranges::all_of(v, [](int value) { return value % 2 == 0; }));
+}
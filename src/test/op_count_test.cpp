@@ -0,0 +1,353 @@
+// MIT License
+//
+// Copyright (c) 2026 Justin Elliott (github.com/justin-elliott)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// The number of element operations (constructions, assignments, destructions and comparisons) that each member of
+// inplace_vector performs: for an expensive element type, the real cost model. Every case starts from the same
+// operands and compares the exact counts against its expectation, so a change that adds a redundant move fails here.
+
+#include "inplace_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <forward_list>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace {
+
+/// The number of each kind of operation performed on the elements of a type.
+struct op_counts
+{
+    std::size_t default_constructed = 0;
+    std::size_t value_constructed   = 0;
+    std::size_t copy_constructed    = 0;
+    std::size_t move_constructed    = 0;
+    std::size_t copy_assigned       = 0;
+    std::size_t move_assigned       = 0;
+    std::size_t destroyed           = 0;
+    std::size_t compared            = 0;
+
+    friend bool operator==(const op_counts&, const op_counts&) = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const op_counts& counts)
+    {
+        return os << "{default_constructed: " << counts.default_constructed
+                  << ", value_constructed: "  << counts.value_constructed
+                  << ", copy_constructed: "   << counts.copy_constructed
+                  << ", move_constructed: "   << counts.move_constructed
+                  << ", copy_assigned: "      << counts.copy_assigned
+                  << ", move_assigned: "      << counts.move_assigned
+                  << ", destroyed: "          << counts.destroyed
+                  << ", compared: "           << counts.compared << "}";
+    }
+};
+
+/// An element that counts every operation performed on it. Moves leave the value in place, so that the contents of
+/// a vector can be checked after any operation.
+/// @tparam Relocatable Whether the type is declared trivially relocatable (see jell::is_trivially_relocatable).
+template <bool Relocatable>
+class Counted
+{
+public:
+    inline static op_counts counts;
+
+    Counted() noexcept { ++counts.default_constructed; }
+    explicit Counted(std::size_t value) noexcept : value_{value} { ++counts.value_constructed; }
+    Counted(const Counted& other) noexcept : value_{other.value_} { ++counts.copy_constructed; }
+    Counted(Counted&& other) noexcept : value_{other.value_} { ++counts.move_constructed; }
+
+    Counted& operator=(const Counted& other) noexcept
+    {
+        value_ = other.value_;
+        ++counts.copy_assigned;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) noexcept
+    {
+        value_ = other.value_;
+        ++counts.move_assigned;
+        return *this;
+    }
+
+    ~Counted() { ++counts.destroyed; }
+
+    std::size_t value() const noexcept { return value_; }
+
+    friend bool operator==(const Counted& lhs, const Counted& rhs) noexcept
+    {
+        ++counts.compared;
+        return lhs.value_ == rhs.value_;
+    }
+
+    friend std::strong_ordering operator<=>(const Counted& lhs, const Counted& rhs) noexcept
+    {
+        ++counts.compared;
+        return lhs.value_ <=> rhs.value_;
+    }
+
+private:
+    std::size_t value_ = 0;
+};
+
+} // namespace
+
+namespace jell {
+
+template <>
+struct is_trivially_relocatable<Counted<true>> : std::true_type {};
+
+} // namespace jell
+
+namespace {
+
+/// A single-pass iterator over an array, so that the number of elements it yields can't be determined in advance.
+template <typename T>
+class InputIterator
+{
+public:
+    using iterator_concept = std::input_iterator_tag;
+    using difference_type  = std::ptrdiff_t;
+    using value_type       = T;
+
+    InputIterator() = default;
+    explicit InputIterator(const T* pos) : pos_{pos} {}
+
+    const T& operator*() const { return *pos_; }
+
+    InputIterator& operator++() { ++pos_; return *this; }
+    void operator++(int) { ++pos_; }
+
+    friend bool operator==(const InputIterator&, const InputIterator&) = default;
+
+private:
+    const T* pos_ = nullptr;
+};
+
+static_assert(std::input_iterator<InputIterator<int>>);
+static_assert(!std::forward_iterator<InputIterator<int>>);
+
+template <typename T>
+using vector = jell::inplace_vector<T, 16>;
+
+/// The state on which each operation acts: a vector of 8 elements, another of 4, a source of 4 elements to insert
+/// (and a forward_list copy of it), and a place for the operation to construct a new vector. Values are counted from
+/// 0, 100 and 200 respectively.
+template <typename T>
+struct operands
+{
+    static constexpr std::size_t size = 8;
+
+    vector<T> lhs = make(0, size);
+    vector<T> rhs = make(100, 4);
+    std::array<T, 4> source{T{200}, T{201}, T{202}, T{203}};
+    std::forward_list<T> list{source.begin(), source.end()};
+    std::optional<vector<T>> result;
+
+    static vector<T> make(std::size_t first, std::size_t count)
+    {
+        vector<T> v;
+        for (std::size_t i = 0; i != count; ++i) {
+            v.emplace_back(first + i);
+        }
+        return v;
+    }
+
+    auto input_begin() const { return InputIterator<T>{source.data()}; }
+    auto input_end() const { return InputIterator<T>{source.data() + source.size()}; }
+};
+
+template <typename T>
+struct op_count_case
+{
+    const char* name;
+    std::function<void(operands<T>&)> operation;
+    op_counts expected;
+
+    friend void PrintTo(const op_count_case& test_case, std::ostream* os) { *os << test_case.name; }
+};
+
+template <typename T>
+op_counts count_operations(const op_count_case<T>& test_case)
+{
+    operands<T> ops;
+    T::counts = {};
+    test_case.operation(ops);
+    return std::exchange(T::counts, {});
+}
+
+bool is_even(const auto& value) { return value.value() % 2 == 0; }
+
+using Element = Counted<false>;
+
+// Shifting s - p elements up to insert at p (into a vector of size s) move-constructs each into the uninitialized
+// slot above it and destroys the original, and shifting down to erase move-assigns each over its predecessor.
+const op_count_case<Element> element_cases[] = {
+    // Construction.
+    {"construct_count", [](auto& o) { o.result.emplace(4); }, {.default_constructed = 4}},
+    {"construct_count_value", [](auto& o) { o.result.emplace(4, o.source[0]); }, {.copy_constructed = 4}},
+    {"construct_iterators", [](auto& o) { o.result.emplace(o.source.begin(), o.source.end()); },
+     {.copy_constructed = 4}},
+    {"construct_input_iterators", [](auto& o) { o.result.emplace(o.input_begin(), o.input_end()); },
+     {.copy_constructed = 4}},
+    {"construct_range", [](auto& o) { o.result.emplace(std::from_range, o.source); }, {.copy_constructed = 4}},
+    {"copy_construct", [](auto& o) { o.result.emplace(o.lhs); }, {.copy_constructed = 8}},
+    {"move_construct", [](auto& o) { o.result.emplace(std::move(o.lhs)); }, {.move_constructed = 8}},
+    {"copy_construct_other_capacity", [](auto& o) { jell::inplace_vector<Element, 32> v(o.lhs); },
+     {.copy_constructed = 8, .destroyed = 8}},
+    {"move_construct_other_capacity", [](auto& o) { jell::inplace_vector<Element, 32> v(std::move(o.lhs)); },
+     {.move_constructed = 8, .destroyed = 16}},
+
+    // Assignment.
+    {"copy_assign_larger", [](auto& o) { o.rhs = o.lhs; }, {.copy_constructed = 4, .copy_assigned = 4}},
+    {"copy_assign_smaller", [](auto& o) { o.lhs = o.rhs; }, {.copy_assigned = 4, .destroyed = 4}},
+    // Move assignment leaves the source empty.
+    {"move_assign_larger", [](auto& o) { o.rhs = std::move(o.lhs); },
+     {.move_constructed = 4, .move_assigned = 4, .destroyed = 8}},
+    {"move_assign_smaller", [](auto& o) { o.lhs = std::move(o.rhs); }, {.move_assigned = 4, .destroyed = 8}},
+    {"assign_count_value", [](auto& o) { o.lhs.assign(4, o.source[0]); }, {.copy_assigned = 4, .destroyed = 4}},
+    {"assign_iterators", [](auto& o) { o.rhs.assign(o.lhs.begin(), o.lhs.end()); },
+     {.copy_constructed = 4, .copy_assigned = 4}},
+    {"assign_input_iterators", [](auto& o) { o.lhs.assign(o.input_begin(), o.input_end()); },
+     {.copy_constructed = 4, .destroyed = 8}},
+    {"assign_range", [](auto& o) { o.lhs.assign_range(o.source); }, {.copy_assigned = 4, .destroyed = 4}},
+
+    // Resizing.
+    {"resize_grow", [](auto& o) { o.lhs.resize(12); }, {.default_constructed = 4}},
+    {"resize_grow_value", [](auto& o) { o.lhs.resize(12, o.source[0]); }, {.copy_constructed = 4}},
+    {"resize_shrink", [](auto& o) { o.lhs.resize(4); }, {.destroyed = 4}},
+    {"clear", [](auto& o) { o.lhs.clear(); }, {.destroyed = 8}},
+
+    // Appending.
+    {"push_back_copy", [](auto& o) { o.lhs.push_back(o.source[0]); }, {.copy_constructed = 1}},
+    {"push_back_move", [](auto& o) { o.lhs.push_back(std::move(o.source[0])); }, {.move_constructed = 1}},
+    {"emplace_back", [](auto& o) { o.lhs.emplace_back(1uz); }, {.value_constructed = 1}},
+    {"append_range", [](auto& o) { o.lhs.append_range(o.source); }, {.copy_constructed = 4}},
+    {"pop_back", [](auto& o) { o.lhs.pop_back(); }, {.destroyed = 1}},
+
+    // Insertion, shifting s - p elements.
+    {"insert_front", [](auto& o) { o.lhs.insert(o.lhs.begin(), o.source[0]); },
+     {.copy_constructed = 1, .move_constructed = 8, .destroyed = 8}},
+    {"insert_middle", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, o.source[0]); },
+     {.copy_constructed = 1, .move_constructed = 3, .destroyed = 3}},
+    {"insert_back", [](auto& o) { o.lhs.insert(o.lhs.end(), o.source[0]); }, {.copy_constructed = 1}},
+    {"insert_move", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, std::move(o.source[0])); },
+     {.move_constructed = 4, .destroyed = 3}},
+    {"insert_count", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, 3, o.source[0]); },
+     {.copy_constructed = 3, .move_constructed = 3, .destroyed = 3}},
+    {"insert_iterators", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, o.source.begin(), o.source.end()); },
+     {.copy_constructed = 4, .move_constructed = 3, .destroyed = 3}},
+    {"insert_forward_iterators", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, o.list.begin(), o.list.end()); },
+     {.copy_constructed = 4, .move_constructed = 3, .destroyed = 3}},
+    // The length of an input sequence is unknown, so the tail is shifted to the top of the capacity and back again.
+    {"insert_input_iterators", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, o.input_begin(), o.input_end()); },
+     {.copy_constructed = 4, .move_constructed = 6, .destroyed = 6}},
+    {"insert_range", [](auto& o) { o.lhs.insert_range(o.lhs.begin() + 5, o.source); },
+     {.copy_constructed = 4, .move_constructed = 3, .destroyed = 3}},
+    {"emplace", [](auto& o) { o.lhs.emplace(o.lhs.begin() + 5, 1uz); },
+     {.value_constructed = 1, .move_constructed = 3, .destroyed = 3}},
+    {"insertion_session",
+     [](auto& o) {
+         auto session = o.lhs.open_insertion(o.lhs.begin() + 5);
+         session.emplace(1uz);
+         session.emplace(2uz);
+     },
+     {.value_constructed = 2, .move_constructed = 6, .destroyed = 6}},
+
+    // Erasure, shifting s - p - 1 elements.
+    {"erase_front", [](auto& o) { o.lhs.erase(o.lhs.begin()); }, {.move_assigned = 7, .destroyed = 1}},
+    {"erase_middle", [](auto& o) { o.lhs.erase(o.lhs.begin() + 5); }, {.move_assigned = 2, .destroyed = 1}},
+    {"erase_back", [](auto& o) { o.lhs.erase(o.lhs.end() - 1); }, {.destroyed = 1}},
+    {"erase_range", [](auto& o) { o.lhs.erase(o.lhs.begin() + 2, o.lhs.begin() + 5); },
+     {.move_assigned = 3, .destroyed = 3}},
+    {"unordered_erase", [](auto& o) { o.lhs.unordered_erase(o.lhs.begin() + 2); },
+     {.move_assigned = 1, .destroyed = 1}},
+    {"unordered_erase_if", [](auto& o) { o.lhs.unordered_erase_if(is_even<Element>); },
+     {.move_assigned = 3, .destroyed = 4}},
+    {"erase_indices", [](auto& o) { o.lhs.erase_indices(std::array{1uz, 3uz, 5uz}); },
+     {.move_assigned = 4, .destroyed = 3}},
+    {"erase_value", [](auto& o) { std::erase(o.lhs, o.lhs[3]); },
+     {.move_assigned = 4, .destroyed = 1, .compared = 8}},
+    {"erase_if", [](auto& o) { std::erase_if(o.lhs, is_even<Element>); }, {.move_assigned = 4, .destroyed = 4}},
+
+    // Swapping: std::swap of the 4 common elements, then moving the tail of the longer vector across.
+    {"swap", [](auto& o) { o.lhs.swap(o.rhs); }, {.move_constructed = 8, .move_assigned = 8, .destroyed = 8}},
+
+    // Comparison.
+    {"equal", [](auto& o) { static_cast<void>(o.lhs == o.lhs); }, {.compared = 8}},
+    {"equal_different_sizes", [](auto& o) { static_cast<void>(o.lhs == o.rhs); }, {}},
+    {"three_way", [](auto& o) { static_cast<void>(o.lhs <=> o.rhs); }, {.compared = 1}},
+};
+
+// Trivially relocatable elements are shifted and transferred with memcpy, so are neither moved nor destroyed.
+using RelocatableElement = Counted<true>;
+
+const op_count_case<RelocatableElement> relocatable_cases[] = {
+    {"move_construct_other_capacity",
+     [](auto& o) { jell::inplace_vector<RelocatableElement, 32> v(std::move(o.lhs)); }, {.destroyed = 8}},
+    {"insert_front", [](auto& o) { o.lhs.insert(o.lhs.begin(), o.source[0]); }, {.copy_constructed = 1}},
+    {"insert_input_iterators", [](auto& o) { o.lhs.insert(o.lhs.begin() + 5, o.input_begin(), o.input_end()); },
+     {.copy_constructed = 4}},
+    {"insertion_session",
+     [](auto& o) {
+         auto session = o.lhs.open_insertion(o.lhs.begin() + 5);
+         session.emplace(1uz);
+         session.emplace(2uz);
+     },
+     {.value_constructed = 2}},
+    {"erase_front", [](auto& o) { o.lhs.erase(o.lhs.begin()); }, {.destroyed = 1}},
+    {"unordered_erase", [](auto& o) { o.lhs.unordered_erase(o.lhs.begin() + 2); }, {.destroyed = 1}},
+    {"erase_indices", [](auto& o) { o.lhs.erase_indices(std::array{1uz, 3uz, 5uz}); }, {.destroyed = 3}},
+    {"swap", [](auto& o) { o.lhs.swap(o.rhs); }, {}},
+};
+
+template <typename T>
+class OpCountTest : public testing::TestWithParam<op_count_case<T>>
+{
+};
+
+using ElementOpCountTest = OpCountTest<Element>;
+using RelocatableOpCountTest = OpCountTest<RelocatableElement>;
+
+TEST_P(ElementOpCountTest, performs_expected_operations)
+{
+    EXPECT_EQ(count_operations(GetParam()), GetParam().expected);
+}
+
+TEST_P(RelocatableOpCountTest, performs_expected_operations)
+{
+    EXPECT_EQ(count_operations(GetParam()), GetParam().expected);
+}
+
+const auto case_name = [](const auto& info) { return std::string{info.param.name}; };
+
+INSTANTIATE_TEST_SUITE_P(Element, ElementOpCountTest, testing::ValuesIn(element_cases), case_name);
+INSTANTIATE_TEST_SUITE_P(Relocatable, RelocatableOpCountTest, testing::ValuesIn(relocatable_cases), case_name);
+
+} // namespace